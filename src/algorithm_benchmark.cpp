@@ -5,10 +5,28 @@
 #include "algorithm_benchmark.h"
 
 void algorithm_benchmark::solve () {
-    const int BFS_SEQ = 1;
-    const int BFS_PAR = 2;
-    const int IDDFS_SEQ = 4;
-    const int IDDFS_PAR = 8;
+    const unsigned long long BFS_SEQ = algorithm_bit(algorithm_type::BFS_SEQ);
+    const unsigned long long BFS_PAR = algorithm_bit(algorithm_type::BFS_PAR);
+    const unsigned long long IDDFS_SEQ = algorithm_bit(algorithm_type::IDDFS_SEQ);
+    const unsigned long long IDDFS_PAR = algorithm_bit(algorithm_type::IDDFS_PAR);
+    const unsigned long long PORTFOLIO = algorithm_bit(algorithm_type::PORTFOLIO);
+    const unsigned long long BFS_SHM = algorithm_bit(algorithm_type::BFS_SHM);
+    const unsigned long long BFS_DIST = algorithm_bit(algorithm_type::BFS_DIST);
+    const unsigned long long UCS_SEQ = algorithm_bit(algorithm_type::UCS_SEQ);
+    const unsigned long long UCS_PAR = algorithm_bit(algorithm_type::UCS_PAR);
+    const unsigned long long BEAM_SEQ = algorithm_bit(algorithm_type::BEAM_SEQ);
+    const unsigned long long BEAM_PAR = algorithm_bit(algorithm_type::BEAM_PAR);
+    const unsigned long long FRONTIER_SEQ = algorithm_bit(algorithm_type::FRONTIER_SEQ);
+    const unsigned long long FRONTIER_PAR = algorithm_bit(algorithm_type::FRONTIER_PAR);
+    const unsigned long long WALKSAT_SEQ = algorithm_bit(algorithm_type::WALKSAT_SEQ);
+    const unsigned long long WALKSAT_PAR = algorithm_bit(algorithm_type::WALKSAT_PAR);
+    const unsigned long long CUBE_SEQ = algorithm_bit(algorithm_type::CUBE_SEQ);
+    const unsigned long long CUBE_PAR = algorithm_bit(algorithm_type::CUBE_PAR);
+    const unsigned long long GRAY_SEQ = algorithm_bit(algorithm_type::GRAY_SEQ);
+    const unsigned long long GRAY_PAR = algorithm_bit(algorithm_type::GRAY_PAR);
+    const unsigned long long JPS = algorithm_bit(algorithm_type::JPS);
+    const unsigned long long WAVE_SEQ = algorithm_bit(algorithm_type::WAVE_SEQ);
+    const unsigned long long WAVE_PAR = algorithm_bit(algorithm_type::WAVE_PAR);
 
     if ( algorithm_mask & BFS_SEQ ) results.push_back(run_algorithm("BFS (Sequential)", [this]() { return solve_bfs(false); }));
 
@@ -18,49 +36,115 @@ void algorithm_benchmark::solve () {
 
     if ( algorithm_mask & IDDFS_PAR ) results.push_back(run_algorithm("IDDFS (Parallel)", [this]() { return solve_iddfs(true); }));
 
+    if ( algorithm_mask & PORTFOLIO ) results.push_back(run_algorithm("Portfolio (Parallel)", [this]() { return solve_portfolio(); }));
+
+    if ( algorithm_mask & BFS_SHM ) results.push_back(run_algorithm("BFS (Multi-process)", [this]() { return solve_shm_bfs(); }));
+
+    if ( algorithm_mask & BFS_DIST ) results.push_back(run_algorithm("BFS (Distributed)", [this]() { return solve_dist_bfs(); }));
+
+    if ( algorithm_mask & UCS_SEQ ) results.push_back(run_algorithm("UCS (Sequential)", [this]() { return solve_ucs(false); }));
+
+    if ( algorithm_mask & UCS_PAR ) results.push_back(run_algorithm("UCS (Parallel)", [this]() { return solve_ucs(true); }));
+
+    if ( algorithm_mask & BEAM_SEQ ) results.push_back(run_algorithm("Beam (Sequential)", [this]() { return solve_beam(false); }));
+
+    if ( algorithm_mask & BEAM_PAR ) results.push_back(run_algorithm("Beam (Parallel)", [this]() { return solve_beam(true); }));
+
+    if ( algorithm_mask & FRONTIER_SEQ ) results.push_back(run_algorithm("Frontier BFS (Sequential)", [this]() { return solve_frontier_bfs(false); }));
+
+    if ( algorithm_mask & FRONTIER_PAR ) results.push_back(run_algorithm("Frontier BFS (Parallel)", [this]() { return solve_frontier_bfs(true); }));
+
+    if ( algorithm_mask & WALKSAT_SEQ ) results.push_back(run_algorithm("WalkSAT (Sequential)", [this]() { return solve_walksat(false); }));
+
+    if ( algorithm_mask & WALKSAT_PAR ) results.push_back(run_algorithm("WalkSAT (Parallel)", [this]() { return solve_walksat(true); }));
+
+    if ( algorithm_mask & CUBE_SEQ ) results.push_back(run_algorithm("Cube and Conquer (Sequential)", [this]() { return solve_cube(false); }));
+
+    if ( algorithm_mask & CUBE_PAR ) results.push_back(run_algorithm("Cube and Conquer (Parallel)", [this]() { return solve_cube(true); }));
+
+    if ( algorithm_mask & GRAY_SEQ ) results.push_back(run_algorithm("Gray Code (Sequential)", [this]() { return solve_gray_code(false); }));
+
+    if ( algorithm_mask & GRAY_PAR ) results.push_back(run_algorithm("Gray Code (Parallel)", [this]() { return solve_gray_code(true); }));
+
+    if ( algorithm_mask & JPS ) results.push_back(run_algorithm("Jump Point Search (Sequential)", [this]() { return solve_jps(); }));
+
+    if ( algorithm_mask & WAVE_SEQ ) results.push_back(run_algorithm("Wavefront BFS (Sequential)", [this]() { return solve_wavefront(false); }));
+
+    if ( algorithm_mask & WAVE_PAR ) results.push_back(run_algorithm("Wavefront BFS (Parallel)", [this]() { return solve_wavefront(true); }));
+
     print_results();
 }
 
 algorithm_result algorithm_benchmark::solve_bfs ( bool parallel ) {
-    bfs_solver solver(initial_state);
-    state_pointer solution;
+    return run_solver(parallel ? algorithm_type::BFS_PAR : algorithm_type::BFS_SEQ,
+                      parallel ? "BFS (Parallel)" : "BFS (Sequential)");
+}
 
-    auto start_time = std::chrono::steady_clock::now();
+algorithm_result algorithm_benchmark::solve_iddfs ( bool parallel ) {
+    return run_solver(parallel ? algorithm_type::IDDFS_PAR : algorithm_type::IDDFS_SEQ,
+                      parallel ? "IDDFS (Parallel)" : "IDDFS (Sequential)");
+}
 
-    if ( parallel ) {
-        solution = solver.solve_par();
-    } else {
-        solution = solver.solve_seq();
-    }
+algorithm_result algorithm_benchmark::solve_portfolio () {
+    return run_solver(algorithm_type::PORTFOLIO, "Portfolio (Parallel)");
+}
 
-    auto end_time = std::chrono::steady_clock::now();
+algorithm_result algorithm_benchmark::solve_shm_bfs () {
+    return run_solver(algorithm_type::BFS_SHM, "BFS (Multi-process)");
+}
 
-    std::chrono::duration<double> duration = end_time - start_time;
+algorithm_result algorithm_benchmark::solve_dist_bfs () {
+    return run_solver(algorithm_type::BFS_DIST, "BFS (Distributed)");
+}
 
-    return { parallel ? algorithm_type::BFS_PAR : algorithm_type::BFS_SEQ,
-             parallel ? "BFS (Parallel)" : "BFS (Sequential)",
-             duration, solution != nullptr };
+algorithm_result algorithm_benchmark::solve_ucs ( bool parallel ) {
+    return run_solver(parallel ? algorithm_type::UCS_PAR : algorithm_type::UCS_SEQ,
+                      parallel ? "UCS (Parallel)" : "UCS (Sequential)");
 }
 
-algorithm_result algorithm_benchmark::solve_iddfs ( bool parallel ) {
-    iddfs_solver solver(initial_state);
-    state_pointer solution;
+algorithm_result algorithm_benchmark::solve_beam ( bool parallel ) {
+    return run_solver(parallel ? algorithm_type::BEAM_PAR : algorithm_type::BEAM_SEQ,
+                      parallel ? "Beam (Parallel)" : "Beam (Sequential)");
+}
 
-    auto start_time = std::chrono::steady_clock::now();
+algorithm_result algorithm_benchmark::solve_frontier_bfs ( bool parallel ) {
+    return run_solver(parallel ? algorithm_type::FRONTIER_PAR : algorithm_type::FRONTIER_SEQ,
+                      parallel ? "Frontier BFS (Parallel)" : "Frontier BFS (Sequential)");
+}
 
-    if ( parallel ) {
-        solution = solver.solve_par();
-    } else {
-        solution = solver.solve_seq();
-    }
+algorithm_result algorithm_benchmark::solve_walksat ( bool parallel ) {
+    return run_solver(parallel ? algorithm_type::WALKSAT_PAR : algorithm_type::WALKSAT_SEQ,
+                      parallel ? "WalkSAT (Parallel)" : "WalkSAT (Sequential)");
+}
+
+algorithm_result algorithm_benchmark::solve_cube ( bool parallel ) {
+    return run_solver(parallel ? algorithm_type::CUBE_PAR : algorithm_type::CUBE_SEQ,
+                      parallel ? "Cube and Conquer (Parallel)" : "Cube and Conquer (Sequential)");
+}
+
+algorithm_result algorithm_benchmark::solve_gray_code ( bool parallel ) {
+    return run_solver(parallel ? algorithm_type::GRAY_PAR : algorithm_type::GRAY_SEQ,
+                      parallel ? "Gray Code (Parallel)" : "Gray Code (Sequential)");
+}
+
+algorithm_result algorithm_benchmark::solve_jps () {
+    return run_solver(algorithm_type::JPS, "Jump Point Search (Sequential)");
+}
+
+algorithm_result algorithm_benchmark::solve_wavefront ( bool parallel ) {
+    return run_solver(parallel ? algorithm_type::WAVE_PAR : algorithm_type::WAVE_SEQ,
+                      parallel ? "Wavefront BFS (Parallel)" : "Wavefront BFS (Sequential)");
+}
 
-    auto end_time = std::chrono::steady_clock::now();
+algorithm_result algorithm_benchmark::run_solver ( algorithm_type type, const std::string &name ) {
+    solve_options run_options = options;
+    run_options.algorithm = type;
 
-    std::chrono::duration<double> duration = end_time - start_time;
+    solve_result result = search_api::solve(initial_state, run_options);
 
-    return { parallel ? algorithm_type::IDDFS_PAR : algorithm_type::IDDFS_SEQ,
-             parallel ? "IDDFS (Parallel)" : "IDDFS (Sequential)",
-             duration, solution != nullptr };
+    return { type, name, result.stats.duration, result.found_solution,
+             result.stats.expanded_states, result.stats.path_length, result.stats.path_cost,
+             result.stats.winner ? get_algorithm_name(*result.stats.winner) : "", result.stats.proven_optimal };
 }
 
 algorithm_result algorithm_benchmark::run_algorithm ( const std::string &name, std::function<algorithm_result()> algorithm ) {
@@ -74,10 +158,15 @@ void algorithm_benchmark::print_results () const {
     for ( const auto& result : results ) {
         std::cout << result.algorithm_name << ": ";
         if ( result.found_solution ) {
-            std::cout << "Solution found in " << result.duration.count() << " seconds.\n";
+            std::cout << "Solution found in " << result.duration.count() << " seconds. "
+                      << "Path length: " << result.path_length;
+            if ( result.path_cost != result.path_length ) std::cout << ", path cost: " << result.path_cost;
+            std::cout << ", expanded states: " << result.expanded_states << ".\n";
         } else {
             std::cout << "Solution not found. Time: " << result.duration.count() << " seconds.\n";
         }
+        if ( !result.winner.empty() ) std::cout << "    Answer from: " << result.winner << "\n";
+        if ( result.proven_optimal ) std::cout << "    Proven optimal: " << ( *result.proven_optimal ? "yes" : "no" ) << "\n";
     }
     std::cout << "--------------------\n";
 }
\ No newline at end of file
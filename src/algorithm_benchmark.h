@@ -26,32 +26,11 @@
 #include <queue>
 #include <map>
 
-#include "algorithms/bfs_solver.h"
-#include "algorithms/iddfs_solver.h"
+#include "algorithm_result.h"
+#include "search_api.h"
 #include "state.h"
 
 
-/**
- * @brief Enum defining the types of algorithms available for benchmarking.
- */
-enum class algorithm_type : int {
-    BFS_SEQ,     ///< Sequential Breadth-First Search
-    BFS_PAR,     ///< Parallel Breadth-First Search
-    IDDFS_SEQ,   ///< Sequential Iterative Deepening Depth-First Search
-    IDDFS_PAR    ///< Parallel Iterative Deepening Depth-First Search
-};
-
-/**
- * @brief Structure to store the result of an algorithm's execution.
- */
-struct algorithm_result {
-    algorithm_type algorithm_type; ///< The type of the algorithm.
-    std::string algorithm_name;    ///< The name of the algorithm.
-    std::chrono::duration<double> duration; ///< The execution time of the algorithm in seconds.
-    bool found_solution;            ///< Flag indicating whether a solution was found.
-};
-
-
 /**
  * @brief Class for benchmarking search algorithms.
  *
@@ -69,10 +48,31 @@ public:
      *                       - 2 (BFS_PAR):  Run parallel BFS.
      *                       - 4 (IDDFS_SEQ): Run sequential IDDFS.
      *                       - 8 (IDDFS_PAR): Run parallel IDDFS.
+     *                       - 16 (PORTFOLIO): Race parallel BFS and IDDFS.
+     *                       - 32 (BFS_SHM): Run BFS in several worker processes.
+     *                       - 64 (BFS_DIST): Run this rank of a distributed BFS.
+     *                       - 128 (UCS_SEQ): Run sequential Uniform-Cost Search.
+     *                       - 256 (UCS_PAR): Run parallel Uniform-Cost Search.
+     *                       - 512 (BEAM_SEQ): Run sequential beam search.
+     *                       - 1024 (BEAM_PAR): Run parallel beam search.
+     *                       - 2048 (FRONTIER_SEQ): Run sequential frontier search.
+     *                       - 4096 (FRONTIER_PAR): Run parallel frontier search.
+     *                       - 8192 (WALKSAT_SEQ): Run sequential WalkSAT local search (SAT only).
+     *                       - 16384 (WALKSAT_PAR): Run WalkSAT restarts on all threads (SAT only).
+     *                       - 32768 (CUBE_SEQ): Run sequential cube and conquer (SAT only).
+     *                       - 65536 (CUBE_PAR): Run cube and conquer with work-stealing workers (SAT only).
+     *                       - 131072 (GRAY_SEQ): Run sequential exhaustive Gray-code search (SAT only).
+     *                       - 262144 (GRAY_PAR): Run Gray-code search over ranges on all threads (SAT only).
+     *                       - 524288 (JPS): Run jump point search with precomputed jumps (unweighted mazes only).
+     *                       - 1048576 (WAVE_SEQ): Run sequential bit-parallel wavefront BFS (mazes only).
+     *                       - 2097152 (WAVE_PAR): Run wavefront BFS with row bands on all threads (mazes only).
      *                       - Combinations are possible (e.g., 1 | 2 to run both BFS versions).
+     *                       The bit of each algorithm is given by `algorithm_bit`.
+     * @param options Settings of the algorithms that need them (process count, distributed rank and endpoint, beam width),
+     *                the algorithm itself is chosen by the mask.
      */
-    algorithm_benchmark ( const state_pointer initial_state, int algorithm_mask )
-        : initial_state ( initial_state ), algorithm_mask ( algorithm_mask ) {}
+    algorithm_benchmark ( const state_pointer initial_state, unsigned long long algorithm_mask, const solve_options &options = {} )
+        : initial_state ( initial_state ), algorithm_mask ( algorithm_mask ), options ( options ) {}
 
     /**
      * @brief Solves the problem using the selected algorithms and records the results.
@@ -98,7 +98,100 @@ public:
      */
     algorithm_result solve_iddfs ( bool parallel );
 
+    /**
+     * @brief Solves the problem by racing parallel BFS and IDDFS and keeping the first answer.
+     *
+     * @return An algorithm_result struct containing the results of the race, including the winning engine.
+     */
+    algorithm_result solve_portfolio ();
+
+    /**
+     * @brief Solves the problem using BFS split between worker processes sharing memory.
+     *
+     * @return An algorithm_result struct containing the results of the multi-process BFS execution.
+     */
+    algorithm_result solve_shm_bfs ();
+
+    /**
+     * @brief Solves the problem as one rank of a BFS distributed between processes connected by sockets.
+     *
+     * @return An algorithm_result struct containing the results of the distributed BFS execution.
+     */
+    algorithm_result solve_dist_bfs ();
+
+    /**
+     * @brief Solves the problem using Uniform-Cost Search with a bucket queue.
+     *
+     * @param parallel If true, runs the parallel version of UCS; otherwise, runs the sequential version.
+     * @return An algorithm_result struct containing the results of the UCS execution.
+     */
+    algorithm_result solve_ucs ( bool parallel );
+
+    /**
+     * @brief Solves the problem using beam search limited to `solve_options::beam_width` states per level.
+     *
+     * @param parallel If true, runs the parallel version of beam search; otherwise, runs the sequential version.
+     * @return An algorithm_result struct containing the results of the beam search, including whether it is exact.
+     */
+    algorithm_result solve_beam ( bool parallel );
+
+    /**
+     * @brief Solves the problem using frontier search, which keeps only the last BFS levels.
+     *
+     * @param parallel If true, runs the parallel version of frontier search; otherwise, runs the sequential version.
+     * @return An algorithm_result struct containing the results of the frontier search execution.
+     */
+    algorithm_result solve_frontier_bfs ( bool parallel );
+
+    /**
+     * @brief Solves the problem using WalkSAT local search, which may give up on satisfiable problems.
+     *
+     * @param parallel If true, runs independent restarts on all threads; otherwise, runs them one after another.
+     * @return An algorithm_result struct containing the results of the local search execution.
+     */
+    algorithm_result solve_walksat ( bool parallel );
+
+    /**
+     * @brief Solves the problem by splitting it into cubes with a lookahead and solving the cubes with DPLL.
+     *
+     * @param parallel If true, the cubes are solved on all threads with work stealing; otherwise, one after another.
+     * @return An algorithm_result struct containing the results of the cube-and-conquer execution.
+     */
+    algorithm_result solve_cube ( bool parallel );
+
+    /**
+     * @brief Solves the problem by trying every assignment in Gray-code order, one variable flip per step.
+     *
+     * @param parallel If true, ranges of assignments are tried on all threads; otherwise, the whole space in order.
+     * @return An algorithm_result struct containing the results of the exhaustive search execution.
+     */
+    algorithm_result solve_gray_code ( bool parallel );
+
+    /**
+     * @brief Solves the maze by jump point search, stopping only at cells where a shortest path may turn.
+     *
+     * @return An algorithm_result struct containing the results of the jump point search execution.
+     */
+    algorithm_result solve_jps ();
+
+    /**
+     * @brief Solves the maze by BFS over bitsets, advancing a whole level with word operations.
+     *
+     * @param parallel If true, the rows of each level are split between the threads.
+     * @return An algorithm_result struct containing the results of the wavefront BFS execution.
+     */
+    algorithm_result solve_wavefront ( bool parallel );
+
 private:
+    /**
+     * @brief Solves the problem with the given algorithm through the search API.
+     *
+     * @param type The algorithm to run.
+     * @param name The name of the algorithm stored in the result.
+     * @return An algorithm_result struct containing the results of the execution.
+     */
+    algorithm_result run_solver ( algorithm_type type, const std::string &name );
+
     /**
      * @brief Runs a specified algorithm, measures its execution time, and prints a message to the console.
      *
@@ -117,7 +210,8 @@ private:
     void print_results () const;
 
     state_pointer initial_state; ///< The initial state of the problem.
-    int algorithm_mask;          ///< A bitmask specifying which algorithms to run.
+    unsigned long long algorithm_mask; ///< A bitmask specifying which algorithms to run.
+    solve_options options; ///< Settings of the algorithms, the algorithm field is overwritten per run.
     std::vector<algorithm_result> results; ///< A vector to store the results of each algorithm.
 };
 
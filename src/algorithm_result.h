@@ -0,0 +1,147 @@
+/**
+ * @file algorithm_result.h
+ * @brief Defines the algorithm_type enum and the algorithm_result struct.
+ *
+ * This header file defines the types shared by the benchmarking code and the public search API:
+ * the `algorithm_type` enum, which identifies a search algorithm, and the `algorithm_result` struct,
+ * which stores the outcome of a single algorithm run.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 12/31/2024
+ */
+
+#ifndef ALGORITHM_RESULT_H
+#define ALGORITHM_RESULT_H
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <cstddef>
+#include <optional>
+
+
+/**
+ * @brief Enum defining the types of algorithms available for benchmarking.
+ */
+enum class algorithm_type : int {
+    BFS_SEQ,     ///< Sequential Breadth-First Search
+    BFS_PAR,     ///< Parallel Breadth-First Search
+    IDDFS_SEQ,   ///< Sequential Iterative Deepening Depth-First Search
+    IDDFS_PAR,   ///< Parallel Iterative Deepening Depth-First Search
+    PORTFOLIO,   ///< Parallel BFS and IDDFS racing on separate threads, the first to finish wins
+    BFS_SHM,     ///< Breadth-First Search split between worker processes sharing memory
+    BFS_DIST,    ///< Breadth-First Search split between processes connected by sockets
+    UCS_SEQ,     ///< Sequential Uniform-Cost Search with a bucket queue
+    UCS_PAR,     ///< Parallel Uniform-Cost Search expanding whole cost buckets
+    BEAM_SEQ,    ///< Sequential beam search keeping the best states of every level
+    BEAM_PAR,    ///< Parallel beam search scoring each beam with OpenMP
+    FRONTIER_SEQ, ///< Sequential frontier search storing only the last BFS levels
+    FRONTIER_PAR, ///< Parallel frontier search expanding each level with OpenMP
+    WALKSAT_SEQ, ///< Sequential WalkSAT local search for SAT problems
+    WALKSAT_PAR, ///< WalkSAT local search running independent restarts on all threads
+    CUBE_SEQ,    ///< Sequential cube-and-conquer SAT search
+    CUBE_PAR,    ///< Cube-and-conquer SAT search solving the cubes on all threads with work stealing
+    GRAY_SEQ,    ///< Sequential exhaustive SAT search in Gray-code order
+    GRAY_PAR,    ///< Exhaustive Gray-code SAT search splitting the assignments into ranges for all threads
+    JPS,         ///< Sequential jump point search with precomputed jumps (JPS+) for mazes
+    WAVE_SEQ,    ///< Sequential bit-parallel wavefront BFS for mazes
+    WAVE_PAR     ///< Bit-parallel wavefront BFS splitting the rows of each level into bands for all threads
+};
+
+/**
+ * @brief Returns the bit representing an algorithm in an algorithm mask.
+ *
+ * @param type The algorithm.
+ * @return The mask bit of the algorithm (1 for BFS_SEQ, 2 for BFS_PAR, 4 for IDDFS_SEQ, ...).
+ */
+constexpr unsigned long long algorithm_bit ( algorithm_type type ) {
+    return 1ULL << static_cast<int>(type);
+}
+
+/**
+ * @brief Checks whether an algorithm runs the parallel variant of its solver.
+ *
+ * @param type The algorithm.
+ * @return `true` if the algorithm uses `solve_par`, `false` if it uses `solve_seq`.
+ */
+constexpr bool is_parallel_algorithm ( algorithm_type type ) {
+    switch ( type ) {
+        case algorithm_type::BFS_SEQ:
+        case algorithm_type::IDDFS_SEQ:
+        case algorithm_type::UCS_SEQ:
+        case algorithm_type::BEAM_SEQ:
+        case algorithm_type::FRONTIER_SEQ:
+        case algorithm_type::WALKSAT_SEQ:
+        case algorithm_type::CUBE_SEQ:
+        case algorithm_type::GRAY_SEQ:
+        case algorithm_type::JPS:
+        case algorithm_type::WAVE_SEQ:
+            return false;
+        case algorithm_type::BFS_PAR:
+        case algorithm_type::IDDFS_PAR:
+        case algorithm_type::PORTFOLIO:
+        case algorithm_type::BFS_SHM:
+        case algorithm_type::BFS_DIST:
+        case algorithm_type::UCS_PAR:
+        case algorithm_type::BEAM_PAR:
+        case algorithm_type::FRONTIER_PAR:
+        case algorithm_type::WALKSAT_PAR:
+        case algorithm_type::CUBE_PAR:
+        case algorithm_type::GRAY_PAR:
+        case algorithm_type::WAVE_PAR:
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Returns the display name of an algorithm.
+ *
+ * @param type The algorithm.
+ * @return The name of the algorithm (e.g., "BFS (Parallel)").
+ */
+constexpr const char* get_algorithm_name ( algorithm_type type ) {
+    switch ( type ) {
+        case algorithm_type::BFS_SEQ: return "BFS (Sequential)";
+        case algorithm_type::BFS_PAR: return "BFS (Parallel)";
+        case algorithm_type::IDDFS_SEQ: return "IDDFS (Sequential)";
+        case algorithm_type::IDDFS_PAR: return "IDDFS (Parallel)";
+        case algorithm_type::PORTFOLIO: return "Portfolio (Parallel)";
+        case algorithm_type::BFS_SHM: return "BFS (Multi-process)";
+        case algorithm_type::BFS_DIST: return "BFS (Distributed)";
+        case algorithm_type::UCS_SEQ: return "UCS (Sequential)";
+        case algorithm_type::UCS_PAR: return "UCS (Parallel)";
+        case algorithm_type::BEAM_SEQ: return "Beam (Sequential)";
+        case algorithm_type::BEAM_PAR: return "Beam (Parallel)";
+        case algorithm_type::FRONTIER_SEQ: return "Frontier BFS (Sequential)";
+        case algorithm_type::FRONTIER_PAR: return "Frontier BFS (Parallel)";
+        case algorithm_type::WALKSAT_SEQ: return "WalkSAT (Sequential)";
+        case algorithm_type::WALKSAT_PAR: return "WalkSAT (Parallel)";
+        case algorithm_type::CUBE_SEQ: return "Cube and Conquer (Sequential)";
+        case algorithm_type::CUBE_PAR: return "Cube and Conquer (Parallel)";
+        case algorithm_type::GRAY_SEQ: return "Gray Code (Sequential)";
+        case algorithm_type::GRAY_PAR: return "Gray Code (Parallel)";
+        case algorithm_type::JPS: return "Jump Point Search (Sequential)";
+        case algorithm_type::WAVE_SEQ: return "Wavefront BFS (Sequential)";
+        case algorithm_type::WAVE_PAR: return "Wavefront BFS (Parallel)";
+    }
+    return "Unknown";
+}
+
+/**
+ * @brief Structure to store the result of an algorithm's execution.
+ */
+struct algorithm_result {
+    ::algorithm_type algorithm_type; ///< The type of the algorithm.
+    std::string algorithm_name;    ///< The name of the algorithm.
+    std::chrono::duration<double> duration; ///< The execution time of the algorithm in seconds.
+    bool found_solution;            ///< Flag indicating whether a solution was found.
+    unsigned long long expanded_states = 0; ///< The number of states expanded by the algorithm.
+    std::size_t path_length = 0;    ///< The number of moves on the solution path (0 if no solution was found).
+    unsigned long long path_cost = 0; ///< The sum of the step costs on the solution path (equals `path_length` with unit costs).
+    std::string winner;             ///< For portfolio runs, the name of the engine that produced the answer.
+    std::optional<bool> proven_optimal; ///< For beam search runs, whether the answer is known to be exact.
+};
+
+#endif //ALGORITHM_RESULT_H
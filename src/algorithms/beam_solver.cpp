@@ -0,0 +1,160 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "beam_solver.h"
+
+#include <algorithm>
+#include <climits>
+#include <deque>
+#include <stdexcept>
+#include <unordered_set>
+#include <omp.h>
+
+beam_solver::beam_solver ( const state_pointer initial_state, std::size_t beam_width ) : solver( initial_state ), beam_width( beam_width ) {
+    if ( beam_width == 0 ) throw std::invalid_argument("Beam width must be positive.");
+}
+
+state_pointer beam_solver::solve_seq () {
+    return search(false);
+}
+
+state_pointer beam_solver::solve_par () {
+    return search(true);
+}
+
+unsigned long long beam_solver::mix_identifier ( unsigned long long identifier ) {
+    // The finalizer of splitmix64, so the sum over a level depends on every bit of every identifier
+    identifier = ( identifier ^ ( identifier >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+    identifier = ( identifier ^ ( identifier >> 27 ) ) * 0x94d049bb133111ebULL;
+    return identifier ^ ( identifier >> 31 );
+}
+
+state_pointer beam_solver::search ( bool parallel ) {
+    expanded_states = 0;
+    proven_optimal = false;
+
+    if ( root->is_goal() ) {
+        proven_optimal = true;
+        return root;
+    }
+
+    std::vector<state_pointer> beam;
+    if ( root->get_heuristic() != state::UNREACHABLE ) beam.push_back(root);
+
+    // Identifiers of the beams of the last KEPT_LEVELS levels, oldest level first
+    std::unordered_set<unsigned long long> kept { root->get_identifier() };
+    std::deque<std::vector<unsigned long long>> kept_levels { { root->get_identifier() } };
+
+    // The next beam depends only on the kept levels, so a repeated window means the beam cycles (Brent's detection)
+    std::deque<unsigned long long> level_signatures { mix_identifier(root->get_identifier()) };
+    std::deque<unsigned long long> saved_signatures;
+    unsigned long long saved_power = 1, saved_age = 0;
+
+    unsigned long long pruned_bound = ULLONG_MAX; // The fewest moves of a solution through a pruned state
+    unsigned long long depth = 0;
+
+    auto better = []( const candidate &a, const candidate &b ) {
+        return a.heuristic != b.heuristic ? a.heuristic < b.heuristic : a.identifier < b.identifier;
+    };
+
+    while ( !stop_requested && !beam.empty() ) {
+        std::vector<candidate> candidates;
+        state_pointer goal = nullptr;
+        unsigned long long level_bound = ULLONG_MAX;
+
+        #pragma omp parallel if ( parallel )
+        {
+            std::vector<candidate> local_candidates;
+            std::unordered_set<unsigned long long> local_ids;
+            state_pointer local_goal = nullptr;
+
+            #pragma omp for schedule(dynamic, 16)
+            for ( size_t i = 0; i < beam.size(); ++i ) {
+                if ( stop_requested ) continue;
+                for ( state_pointer &child : beam[i]->get_descendents() ) {
+                    unsigned long long heuristic = child->get_heuristic();
+                    if ( heuristic == state::UNREACHABLE ) continue;
+
+                    // Drop children kept in a recent beam or already generated by this thread
+                    unsigned long long identifier = child->get_identifier();
+                    if ( kept.count(identifier) || !local_ids.insert(identifier).second ) continue;
+
+                    if ( child->is_goal() && ( local_goal == nullptr || identifier < local_goal->get_identifier() ) ) local_goal = child;
+                    local_candidates.push_back({ std::move(child), heuristic, identifier });
+                }
+            }
+
+            // Every child of the next beam is among the beam_width best of the thread that generated it
+            unsigned long long local_bound = ULLONG_MAX;
+            if ( local_goal == nullptr && local_candidates.size() > beam_width ) {
+                std::nth_element(local_candidates.begin(), local_candidates.begin() + static_cast<std::ptrdiff_t>(beam_width), local_candidates.end(), better);
+                for ( size_t i = beam_width; i < local_candidates.size(); ++i ) {
+                    local_bound = std::min(local_bound, local_candidates[i].heuristic);
+                }
+                local_candidates.resize(beam_width);
+            }
+
+            #pragma omp critical
+            {
+                if ( local_goal != nullptr && ( goal == nullptr || local_goal->get_identifier() < goal->get_identifier() ) ) goal = local_goal;
+                level_bound = std::min(level_bound, local_bound);
+                candidates.insert(candidates.end(), std::make_move_iterator(local_candidates.begin()), std::make_move_iterator(local_candidates.end()));
+            }
+        }
+
+        expanded_states += beam.size();
+        ++depth;
+
+        if ( goal != nullptr ) {
+            proven_optimal = depth <= pruned_bound;
+            return goal;
+        }
+
+        if ( level_bound != ULLONG_MAX ) pruned_bound = std::min(pruned_bound, depth + level_bound);
+
+        // Drop children generated by more than one thread, then select from at most beam_width per thread
+        std::unordered_set<unsigned long long> generated;
+        auto last = std::remove_if(candidates.begin(), candidates.end(), [&]( const candidate &candidate ) {
+            return !generated.insert(candidate.identifier).second;
+        });
+        candidates.erase(last, candidates.end());
+
+        if ( candidates.size() > beam_width ) {
+            std::nth_element(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(beam_width), candidates.end(), better);
+
+            for ( size_t i = beam_width; i < candidates.size(); ++i ) {
+                pruned_bound = std::min(pruned_bound, depth + candidates[i].heuristic);
+            }
+            candidates.resize(beam_width);
+        }
+
+        if ( kept_levels.size() == KEPT_LEVELS ) {
+            for ( unsigned long long identifier : kept_levels.front() ) kept.erase(identifier);
+            kept_levels.pop_front();
+            level_signatures.pop_front();
+        }
+
+        beam.clear();
+        std::vector<unsigned long long> &level = kept_levels.emplace_back();
+        unsigned long long signature = 0;
+        for ( candidate &candidate : candidates ) {
+            kept.insert(candidate.identifier);
+            level.push_back(candidate.identifier);
+            signature += mix_identifier(candidate.identifier);
+            beam.push_back(std::move(candidate.state));
+        }
+        level_signatures.push_back(signature);
+
+        if ( level_signatures == saved_signatures ) break;
+        if ( ++saved_age == saved_power ) {
+            saved_signatures = level_signatures;
+            saved_power *= 2;
+            saved_age = 0;
+        }
+    }
+
+    // An exhausted beam proves there is no solution only if nothing was pruned, a cycling one never does
+    proven_optimal = !stop_requested && beam.empty() && pruned_bound == ULLONG_MAX;
+    return nullptr;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file beam_solver.h
+ * @brief Declares the beam_solver class, which implements a memory-capped beam search.
+ *
+ * This header file defines the `beam_solver` class, which inherits from the `solver` abstract base class.
+ * Like BFS it searches level by level, but it keeps only the `beam_width` children with the lowest
+ * `state::get_heuristic` of every level, so its memory use is bounded by the width instead of the size of the
+ * state space. The price is completeness and optimality, which the solver reports per search.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef BEAM_SOLVER_H
+#define BEAM_SOLVER_H
+
+#pragma once
+
+#include "solver.h"
+#include <cstddef>
+#include <vector>
+
+
+/**
+ * @brief Level-synchronous beam search ranked by the admissible heuristic of the states.
+ *
+ * Each level, all children of the beam are generated and scored, children kept in the current or the previous
+ * beam are dropped, and `std::nth_element` selects the `beam_width` best ones as the next beam (ties are broken
+ * by the identifier, so both variants select the same states). The parallel version expands, scores and
+ * preselects with OpenMP: every thread keeps the `beam_width` best of its own children, and only these are
+ * merged for the final selection.
+ *
+ * Because the heuristic never overestimates, a state pruned at depth `d` cannot lead to a goal in fewer than
+ * `d + h` moves. The solver keeps the smallest such bound; a solution at a depth not above it has the fewest
+ * moves possible.
+ *
+ * Duplicates are detected against the identifiers of the beams of the last `KEPT_LEVELS` levels only, so all
+ * memory the search holds beyond the paths of the beam is proportional to `beam_width`. In the reversible domains
+ * a child can only repeat a state of the last two levels as long as nothing was pruned, so an unpruned search is
+ * still exact. Once states were pruned, the beam may come back to states of older levels; the search then ends
+ * without a solution as soon as the window of kept levels repeats, which Brent's cycle detection notices by
+ * comparing one sum of mixed identifiers per level.
+ */
+class beam_solver : public solver {
+public:
+    /**
+     * @brief Constructor for the beam_solver class.
+     *
+     * @param initial_state The initial state of the problem.
+     * @param beam_width The maximum number of states kept per level.
+     * @throws std::invalid_argument if the beam width is 0.
+     */
+    beam_solver ( const state_pointer initial_state, std::size_t beam_width );
+
+    /**
+     * @brief Solves the problem sequentially using beam search.
+     *
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     */
+    state_pointer solve_seq () override;
+
+    /**
+     * @brief Solves the problem using beam search, expanding and scoring each beam in parallel.
+     *
+     * This implementation uses OpenMP for parallel execution.
+     *
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     */
+    state_pointer solve_par () override;
+
+    /**
+     * @brief Checks whether the outcome of the last search is exact.
+     *
+     * @return `true` if the last search found a solution with the fewest moves, or proved that no solution exists;
+     *         `false` if states that could lead to a better answer were pruned (or the search was stopped).
+     */
+    [[nodiscard]] bool is_proven_optimal () const {
+        return proven_optimal;
+    }
+
+private:
+    /**
+     * @brief A generated child and its heuristic value.
+     */
+    struct candidate {
+        state_pointer state; ///< The child.
+        unsigned long long heuristic; ///< The value of `state::get_heuristic` of the child.
+        unsigned long long identifier; ///< The identifier of the child.
+    };
+
+    /**
+     * @brief The number of most recent levels whose beams are remembered for duplicate detection.
+     */
+    static constexpr std::size_t KEPT_LEVELS = 1024;
+
+    /**
+     * @brief Mixes the bits of an identifier (splitmix64 finalizer), identifiers are often sequential.
+     *
+     * @param identifier The identifier of a state.
+     * @return The mixed identifier.
+     */
+    static unsigned long long mix_identifier ( unsigned long long identifier );
+
+    /**
+     * @brief Runs the beam search.
+     *
+     * @param parallel If true, the beam is expanded and scored with OpenMP.
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     */
+    state_pointer search ( bool parallel );
+
+    std::size_t beam_width; ///< The maximum number of states kept per level.
+    bool proven_optimal = false; ///< Whether the last search is known to be exact.
+};
+
+#endif //BEAM_SOLVER_H
@@ -3,6 +3,12 @@
 //
 
 #include "bfs_solver.h"
+#include "sat_batch_evaluator.h"
+#include "../generators/sat_generator.h"
+
+#include <algorithm>
+#include <optional>
+#include <span>
 
 state_pointer bfs_solver::solve_seq () {
     // prep
@@ -11,8 +17,9 @@ state_pointer bfs_solver::solve_seq () {
     q.push( root );
 
     state_pointer result = nullptr;
+    expanded_states = 0;
 
-    while ( !q.empty() ) {
+    while ( !q.empty() && !stop_requested ) {
         // Get item from queue
         state_pointer current = q.front();
         q.pop();
@@ -33,6 +40,7 @@ state_pointer bfs_solver::solve_seq () {
 
         // Get next steps
         std::vector<state_pointer> next = current->get_descendents();
+        ++expanded_states;
         for ( auto p : next ) {
             q.push( p );
         }
@@ -46,22 +54,33 @@ state_pointer bfs_solver::solve_par() {
     std::vector<state_pointer> next_level = {};
 
     state_pointer result = nullptr;
+    expanded_states = 0;
+
+    // Only descendents are checked inside the loop, so a root that is already a goal is answered here
+    if ( root->is_goal() ) return root;
 
     next_level.push_back( root );
     visited.insert( root->get_identifier() );
 
-    while ( !next_level.empty() && result == nullptr ) {
+    // SAT levels are checked in bit-sliced batches instead of one is_goal call per state
+    std::optional<sat_batch_evaluator> batch;
+    if ( const auto *sat = dynamic_cast<const sat_state*>(root.get()) ) batch.emplace(sat->get_problem());
+
+    while ( !next_level.empty() && result == nullptr && !stop_requested ) {
 
         // Swap current and next level
         current_level = std::exchange( next_level, {} );
+        unsigned long long expanded = 0;
 
-        #pragma omp parallel for schedule(dynamic) shared( current_level, next_level, visited, result )
+        #pragma omp parallel for schedule(dynamic) shared( current_level, next_level, visited, result ) reduction( +:expanded )
         for ( size_t i = 0; i < current_level.size(); ++i ) {
+            if ( stop_requested ) continue;
             state_pointer c_state = current_level[i];
 
             // Create next layer
             std::vector<state_pointer> local_neighbors = c_state->get_descendents();
             std::vector<state_pointer> next_states;
+            ++expanded;
 
             for( size_t j = 0; j < local_neighbors.size(); ++j ) {
                 state_pointer p = local_neighbors[j];
@@ -71,13 +90,33 @@ state_pointer bfs_solver::solve_par() {
                     // If not visited add to next layer else ignore the node
                     if ( visited.find(p_id) == visited.end() ) {
                         // Check if neighbor is target
-                        if ( p->is_goal() && (result == nullptr || p_id < result->get_identifier() ) ) result = p;
+                        if ( !batch && p->is_goal() && (result == nullptr || p_id < result->get_identifier() ) ) result = p;
                         visited.insert( p_id );
                         next_level.push_back( p );
                     }
                 }
             }
         }
+
+        // Publish the level's expansions so progress can be polled while searching
+        expanded_states += expanded;
+
+        if ( batch && !next_level.empty() ) {
+            constexpr std::size_t batch_size = sat_batch_evaluator::BATCH_SIZE;
+            std::size_t num_batches = ( next_level.size() + batch_size - 1 ) / batch_size;
+            std::vector<sat_batch_evaluator::batch_result> masks(num_batches);
+            std::span<const state_pointer> level(next_level);
+
+            #pragma omp parallel for schedule(dynamic)
+            for ( size_t i = 0; i < num_batches; ++i ) {
+                masks[i] = batch->evaluate(level.subspan(i * batch_size, std::min(batch_size, level.size() - i * batch_size)));
+            }
+
+            // Keep the goal with the smallest identifier like the unbatched check, the level itself is left as is
+            for ( size_t i = 0; i < next_level.size(); ++i ) {
+                if ( sat_batch_evaluator::test(masks[i / batch_size].goals, i % batch_size) && (result == nullptr || next_level[i]->get_identifier() < result->get_identifier()) ) result = next_level[i];
+            }
+        }
     }
 
     return result;
@@ -0,0 +1,86 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "component_solver.h"
+
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <omp.h>
+
+component_solver::component_solver ( const state_pointer initial_state, const solver_factory &factory ) : solver( initial_state ) {
+    const auto *sat = dynamic_cast<const sat_state*>(root.get());
+    if ( sat == nullptr ) throw std::invalid_argument("Component decomposition needs a SAT problem.");
+
+    decomposition = sat_decomposer::decompose(sat->get_problem(), sat->get_assignment());
+    for ( const sat_component &component : decomposition.components ) {
+        solvers.push_back(factory(std::make_shared<const sat_state>(nullptr, component.problem)));
+    }
+}
+
+state_pointer component_solver::solve_seq () {
+    return search(false);
+}
+
+state_pointer component_solver::solve_par () {
+    return search(true);
+}
+
+void component_solver::request_stop () {
+    solver::request_stop();
+    for ( auto &part : solvers ) part->request_stop();
+}
+
+state_pointer component_solver::search ( bool parallel ) {
+    expanded_states = 0;
+
+    if ( root->is_goal() ) return root;
+    if ( decomposition.unsatisfiable ) return nullptr;
+
+    for ( auto &part : solvers ) {
+        if ( stop_requested ) part->request_stop();
+        else part->clear_stop_request();
+    }
+
+    // A single component keeps all threads for its own parallel search
+    std::size_t count = solvers.size();
+    bool concurrent = parallel && count > 1;
+    std::vector<state_pointer> answers(count);
+    std::exception_ptr error = nullptr;
+    std::atomic<bool> failed = false;
+
+    #pragma omp parallel for schedule(dynamic, 1) if ( concurrent )
+    for ( std::size_t i = 0; i < count; ++i ) {
+        if ( failed ) continue;
+        try {
+            answers[i] = parallel && !concurrent ? solvers[i]->solve_par() : solvers[i]->solve_seq();
+        } catch ( ... ) {
+            #pragma omp critical
+            if ( error == nullptr ) error = std::current_exception();
+        }
+
+        // A component without a model (or a stopped one) decides the whole search
+        if ( answers[i] == nullptr && !failed.exchange(true) ) {
+            for ( std::size_t j = 0; j < count; ++j ) {
+                if ( j != i ) solvers[j]->request_stop();
+            }
+        }
+    }
+
+    for ( auto &part : solvers ) expanded_states += part->get_expanded_states();
+    if ( error ) std::rethrow_exception(error);
+    if ( failed ) return nullptr;
+
+    // Combine the models and assign the free variables of the root in order
+    std::vector<std::uint8_t> model(root->encode().size(), 0);
+    for ( const auto &[variable, value] : decomposition.fixed_values ) model[variable - 1] = value;
+    for ( std::size_t i = 0; i < count; ++i ) {
+        const auto *answer = dynamic_cast<const sat_state*>(answers[i].get());
+        if ( answer == nullptr ) throw std::logic_error("Component solver returned a state of another problem.");
+        for ( const auto &[variable, value] : answer->get_assignment() ) {
+            model[decomposition.components[i].original_variables[variable - 1] - 1] = value;
+        }
+    }
+    return static_cast<const sat_state&>(*root).assign_remaining(model);
+}
@@ -0,0 +1,92 @@
+/**
+ * @file component_solver.h
+ * @brief Declares the component_solver class, which solves the independent components of a SAT problem separately.
+ *
+ * This header file defines the `component_solver` class, which inherits from the `solver` abstract base class.
+ * It splits a SAT problem with `sat_decomposer`, gives every component its own solver (of any algorithm) and
+ * combines their models, so the search explores the components one at a time instead of their cross product.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef COMPONENT_SOLVER_H
+#define COMPONENT_SOLVER_H
+
+#pragma once
+
+#include "solver.h"
+#include "../preprocessing/sat_decomposer.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+
+/**
+ * @brief Solves every independent component of a `sat_state` problem with its own solver.
+ *
+ * The parallel version solves the components concurrently on the OpenMP threads (each with the sequential variant
+ * of its solver), or runs the parallel variant when there is a single component. The first component without a
+ * model stops the others, since the whole problem then has none. Variables in no clause are set to false.
+ *
+ * The solution is the chain of `sat_state`s of the original problem assigning its free variables in order, like the
+ * other solvers return it. The expanded states are the sum over the component solvers.
+ */
+class component_solver : public solver {
+public:
+    /**
+     * @brief Creates the solver of one component from its initial state.
+     */
+    using solver_factory = std::function<std::unique_ptr<solver> ( const state_pointer& )>;
+
+    /**
+     * @brief Constructor for the component_solver class.
+     *
+     * @param initial_state The initial state of the problem, must be a `sat_state`.
+     * @param factory Creates the solver of every component.
+     * @throws std::invalid_argument if the initial state is not a SAT state.
+     */
+    component_solver ( const state_pointer initial_state, const solver_factory &factory );
+
+    /**
+     * @brief Solves the components one after another with the sequential variant of their solvers.
+     *
+     * @return A state_pointer to a satisfying assignment, or nullptr if there is none.
+     */
+    state_pointer solve_seq () override;
+
+    /**
+     * @brief Solves the components concurrently on the OpenMP threads.
+     *
+     * @return A state_pointer to a satisfying assignment, or nullptr if there is none.
+     */
+    state_pointer solve_par () override;
+
+    /**
+     * @brief Stops the solvers of all components.
+     */
+    void request_stop () override;
+
+    /**
+     * @brief Returns the number of independent components of the problem.
+     *
+     * @return The number of components (0 if every variable is assigned or unconstrained).
+     */
+    [[nodiscard]] std::size_t get_num_components () const {
+        return decomposition.components.size();
+    }
+
+private:
+    /**
+     * @brief Solves the components and combines their models.
+     *
+     * @param parallel If true, the components are solved concurrently.
+     * @return A state_pointer to a satisfying assignment, or nullptr if there is none.
+     */
+    state_pointer search ( bool parallel );
+
+    sat_decomposition decomposition; ///< The components and the values of the other variables.
+    std::vector<std::unique_ptr<solver>> solvers; ///< The solver of every component.
+};
+
+#endif //COMPONENT_SOLVER_H
@@ -0,0 +1,428 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "cube_solver.h"
+#include "../generators/sat_generator.h"
+#include "../preprocessing/sat_preprocessor.h"
+
+#include <algorithm>
+#include <bit>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <omp.h>
+
+namespace {
+    /**
+     * @brief The outcome of a DPLL search under a cube.
+     */
+    enum class dpll_result : int {
+        SATISFIABLE,   ///< A model was found.
+        UNSATISFIABLE, ///< The cube has no model.
+        STOPPED        ///< The search was stopped or another worker found a model.
+    };
+
+    /**
+     * @brief The cubes of one worker, taken from the back by the owner and stolen from the front by the others.
+     */
+    struct cube_queue {
+        std::mutex mutex; ///< Protects `cubes`.
+        std::deque<std::vector<int>> cubes; ///< The cubes not solved yet.
+    };
+
+    /**
+     * @brief Takes the next cube of a worker, stealing one from another worker if its own queue is empty.
+     *
+     * @return `false` if every queue is empty.
+     */
+    bool take_cube ( std::vector<cube_queue> &queues, std::size_t worker, std::vector<int> &cube ) {
+        for ( std::size_t offset = 0; offset < queues.size(); ++offset ) {
+            cube_queue &queue = queues[( worker + offset ) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if ( queue.cubes.empty() ) continue;
+            if ( offset == 0 ) {
+                cube = std::move(queue.cubes.back());
+                queue.cubes.pop_back();
+            } else {
+                cube = std::move(queue.cubes.front());
+                queue.cubes.pop_front();
+            }
+            return true;
+        }
+        return false;
+    }
+}
+
+class cube_solver::engine {
+public:
+    /**
+     * @brief Copies the clauses, watches their first two literals and propagates the unit clauses.
+     */
+    explicit engine ( cube_solver &owner )
+        : owner( owner ), literals( owner.literals ), values( owner.num_variables, -1 ), watches( 2 * static_cast<std::size_t>(owner.num_variables) ) {
+        for ( std::uint32_t clause = 0; clause + 1 < owner.clause_starts.size(); ++clause ) {
+            std::uint32_t begin = owner.clause_starts[clause];
+            if ( owner.clause_starts[clause + 1] - begin == 1 ) {
+                if ( get_value(literals[begin]) == 0 ) consistent = false;
+                else if ( get_value(literals[begin]) < 0 ) enqueue(literals[begin]);
+                continue;
+            }
+            watches[literals[begin]].push_back(clause);
+            watches[literals[begin + 1]].push_back(clause);
+        }
+        if ( consistent ) consistent = propagate();
+    }
+
+    /**
+     * @brief Returns 1 if the literal is true, 0 if it is false and -1 if its variable is unassigned.
+     */
+    [[nodiscard]] int get_value ( int literal ) const {
+        int value = values[literal >> 1];
+        return value < 0 ? -1 : value ^ ( literal & 1 );
+    }
+
+    /**
+     * @brief Makes a literal true at the current level and propagates it.
+     *
+     * @return `false` if the literal is false or propagation found a conflict.
+     */
+    bool assume ( int literal ) {
+        int value = get_value(literal);
+        if ( value >= 0 ) return value == 1;
+        enqueue(literal);
+        return propagate();
+    }
+
+    /**
+     * @brief Probes a literal: assigns it on a new level, propagates and undoes it.
+     *
+     * @param literal The literal to probe.
+     * @param assigned Receives the number of variables the literal assigns, itself included.
+     * @return `false` if the literal leads to a conflict.
+     */
+    bool probe ( int literal, std::size_t &assigned ) {
+        ++expansions;
+        std::size_t level = get_level();
+        std::size_t before = trail.size();
+        new_level();
+        enqueue(literal);
+        bool result = propagate();
+        assigned = trail.size() - before;
+        backtrack(level);
+        return result;
+    }
+
+    /**
+     * @brief Runs DPLL below the current level.
+     */
+    dpll_result solve () {
+        std::size_t base = get_level();
+        std::vector<std::pair<int, bool>> decisions; // The decided literal and whether it is the second branch
+        bool conflict = !propagate();
+
+        while ( true ) {
+            if ( conflict ) {
+                // Flip the deepest decision whose second branch was not tried yet
+                while ( true ) {
+                    if ( decisions.empty() ) return dpll_result::UNSATISFIABLE;
+                    auto [literal, flipped] = decisions.back();
+                    decisions.pop_back();
+                    backtrack(base + decisions.size());
+                    if ( flipped ) continue;
+                    new_level();
+                    decisions.emplace_back(literal ^ 1, true);
+                    enqueue(literal ^ 1);
+                    break;
+                }
+                conflict = !propagate();
+                continue;
+            }
+
+            if ( owner.found || owner.stop_requested ) return dpll_result::STOPPED;
+            int variable = pick_variable();
+            if ( variable < 0 ) return dpll_result::SATISFIABLE;
+
+            ++expansions;
+            new_level();
+            decisions.emplace_back(2 * variable, false);
+            enqueue(2 * variable);
+            conflict = !propagate();
+        }
+    }
+
+    /**
+     * @brief Returns the first variable of the branching order that is not assigned, -1 if there is none.
+     */
+    [[nodiscard]] int pick_variable () const {
+        for ( int variable : owner.branch_order ) {
+            if ( values[variable] < 0 ) return variable;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Returns the first `count` unassigned variables of the branching order.
+     */
+    [[nodiscard]] std::vector<int> get_candidates ( std::size_t count ) const {
+        std::vector<int> candidates;
+        for ( int variable : owner.branch_order ) {
+            if ( candidates.size() == count ) break;
+            if ( values[variable] < 0 ) candidates.push_back(variable);
+        }
+        return candidates;
+    }
+
+    /**
+     * @brief Returns the current assignment, unassigned variables as false.
+     */
+    [[nodiscard]] std::vector<std::uint8_t> get_model () const {
+        std::vector<std::uint8_t> model(values.size());
+        for ( std::size_t variable = 0; variable < values.size(); ++variable ) model[variable] = values[variable] == 1;
+        return model;
+    }
+
+    /**
+     * @brief Returns the number of decisions and probes since the last call.
+     */
+    unsigned long long take_expansions () {
+        return std::exchange(expansions, 0);
+    }
+
+    void new_level () {
+        trail_limits.push_back(trail.size());
+    }
+
+    [[nodiscard]] std::size_t get_level () const {
+        return trail_limits.size();
+    }
+
+    /**
+     * @brief Unassigns every variable assigned above a level.
+     */
+    void backtrack ( std::size_t level ) {
+        if ( trail_limits.size() <= level ) return;
+        std::size_t limit = trail_limits[level];
+        for ( std::size_t i = limit; i < trail.size(); ++i ) values[trail[i] >> 1] = -1;
+        trail.resize(limit);
+        trail_limits.resize(level);
+        propagated = trail.size();
+    }
+
+    bool consistent = true; ///< Cleared if the unit clauses of the problem conflict.
+
+private:
+    void enqueue ( int literal ) {
+        values[literal >> 1] = static_cast<std::int8_t>(( literal & 1 ) ^ 1);
+        trail.push_back(literal);
+    }
+
+    /**
+     * @brief Propagates the assigned literals through the watched literals.
+     *
+     * @return `false` if a clause became false.
+     */
+    bool propagate () {
+        while ( propagated < trail.size() ) {
+            int false_literal = trail[propagated++] ^ 1;
+            std::vector<std::uint32_t> &watching = watches[false_literal];
+
+            std::size_t kept = 0;
+            for ( std::size_t i = 0; i < watching.size(); ++i ) {
+                std::uint32_t clause = watching[i];
+                int *clause_literals = literals.data() + owner.clause_starts[clause];
+                std::uint32_t size = owner.clause_starts[clause + 1] - owner.clause_starts[clause];
+
+                // Keep the false watch in the second position
+                if ( clause_literals[0] == false_literal ) std::swap(clause_literals[0], clause_literals[1]);
+                if ( get_value(clause_literals[0]) == 1 ) {
+                    watching[kept++] = clause;
+                    continue;
+                }
+
+                bool moved = false;
+                for ( std::uint32_t k = 2; k < size; ++k ) {
+                    if ( get_value(clause_literals[k]) != 0 ) {
+                        std::swap(clause_literals[1], clause_literals[k]);
+                        watches[clause_literals[1]].push_back(clause);
+                        moved = true;
+                        break;
+                    }
+                }
+                if ( moved ) continue;
+
+                watching[kept++] = clause;
+                if ( get_value(clause_literals[0]) == 0 ) {
+                    for ( ++i; i < watching.size(); ++i ) watching[kept++] = watching[i];
+                    watching.resize(kept);
+                    propagated = trail.size();
+                    return false;
+                }
+                enqueue(clause_literals[0]);
+            }
+            watching.resize(kept);
+        }
+        return true;
+    }
+
+    cube_solver &owner; ///< The solver owning the problem.
+    std::vector<int> literals; ///< The literals of all clauses, the two watched ones first in every clause.
+    std::vector<std::int8_t> values; ///< The value of every variable, -1 if unassigned.
+    std::vector<std::vector<std::uint32_t>> watches; ///< The clauses watching each literal.
+    std::vector<int> trail; ///< The assigned literals in assignment order.
+    std::vector<std::size_t> trail_limits; ///< The trail size at the start of every level.
+    std::size_t propagated = 0; ///< The number of trail literals already propagated.
+    unsigned long long expansions = 0; ///< The decisions and probes not yet added to `expanded_states`.
+};
+
+cube_solver::cube_solver ( const state_pointer initial_state, unsigned int cube_depth ) : solver( initial_state ), cube_depth( cube_depth ) {
+    const auto *sat = dynamic_cast<const sat_state*>(root.get());
+    if ( sat == nullptr ) throw std::invalid_argument("Cube and conquer needs a SAT problem.");
+
+    sat_problem problem = sat->get_problem();
+    std::map<int, bool> assignment = sat->get_assignment();
+    num_variables = problem.num_variables;
+
+    // Only the clauses left by the initial assignment are searched
+    sat_flat_clauses flat = sat_preprocessor::flatten(problem, assignment);
+    clause_starts = std::move(flat.clause_starts);
+    literals = std::move(flat.literals);
+    contradiction = flat.contradiction;
+    std::vector<unsigned int> occurrences(num_variables, 0);
+    for ( int literal : literals ) ++occurrences[literal >> 1];
+
+    for ( int variable = 0; variable < num_variables; ++variable ) {
+        if ( occurrences[variable] > 0 ) branch_order.push_back(variable);
+    }
+    std::stable_sort(branch_order.begin(), branch_order.end(), [&occurrences]( int a, int b ) { return occurrences[a] > occurrences[b]; });
+}
+
+state_pointer cube_solver::solve_seq () {
+    return search(false);
+}
+
+state_pointer cube_solver::solve_par () {
+    return search(true);
+}
+
+state_pointer cube_solver::search ( bool parallel ) {
+    expanded_states = 0;
+    found = false;
+    num_cubes = 0;
+
+    if ( root->is_goal() ) return root;
+    if ( contradiction ) return nullptr;
+
+    // Cube: split the problem on the lookahead engine
+    int num_workers = parallel ? omp_get_max_threads() : 1;
+    unsigned int depth = cube_depth;
+    if ( depth == 0 ) depth = static_cast<unsigned int>(std::bit_width(static_cast<unsigned int>(num_workers) * CUBES_PER_WORKER - 1));
+
+    engine lookahead(*this);
+    if ( !lookahead.consistent ) return nullptr;
+    std::vector<int> cube;
+    std::vector<std::vector<int>> cubes;
+    split(lookahead, depth, cube, cubes);
+    expanded_states += lookahead.take_expansions();
+    num_cubes = cubes.size();
+    if ( stop_requested ) return nullptr;
+
+    // Conquer: deal the cubes round-robin, the workers steal when their own queue is empty
+    std::vector<cube_queue> queues(num_workers);
+    for ( std::size_t i = 0; i < cubes.size(); ++i ) queues[i % num_workers].cubes.push_back(std::move(cubes[i]));
+
+    std::vector<std::uint8_t> model;
+    bool has_model = false;
+    std::exception_ptr error = nullptr;
+
+    #pragma omp parallel num_threads(num_workers) if ( parallel )
+    {
+        try {
+            engine worker(*this);
+            std::vector<int> assigned;
+            while ( !found && !stop_requested && take_cube(queues, omp_get_thread_num(), assigned) ) {
+                worker.backtrack(0);
+                worker.new_level();
+                bool consistent = std::all_of(assigned.begin(), assigned.end(), [&worker]( int literal ) { return worker.assume(literal); });
+                if ( consistent && worker.solve() == dpll_result::SATISFIABLE && !found.exchange(true) ) {
+                    model = worker.get_model();
+                    has_model = true;
+                }
+                expanded_states += worker.take_expansions();
+            }
+        } catch ( ... ) {
+            #pragma omp critical
+            if ( error == nullptr ) error = std::current_exception();
+            request_stop();
+        }
+    }
+
+    if ( error ) std::rethrow_exception(error);
+    if ( !has_model ) return nullptr;
+    return static_cast<const sat_state&>(*root).assign_remaining(model);
+}
+
+void cube_solver::split ( engine &lookahead, unsigned int depth, std::vector<int> &cube, std::vector<std::vector<int>> &cubes ) {
+    if ( found || stop_requested ) return;
+    std::size_t cube_size = cube.size();
+
+    int best = -1;
+    while ( depth > 0 && best < 0 ) {
+        std::vector<int> candidates = lookahead.get_candidates(LOOKAHEAD_CANDIDATES);
+        if ( candidates.empty() ) break;
+
+        unsigned long long best_score = 0;
+        bool forced = false;
+        for ( int variable : candidates ) {
+            if ( lookahead.get_value(2 * variable) >= 0 ) continue;
+
+            std::size_t assigned_true = 0;
+            std::size_t assigned_false = 0;
+            bool true_consistent = lookahead.probe(2 * variable, assigned_true);
+            bool false_consistent = lookahead.probe(2 * variable + 1, assigned_false);
+
+            // Both values fail: the node has no model. One value fails: the other one is forced (a failed literal)
+            if ( !true_consistent && !false_consistent ) {
+                cube.resize(cube_size);
+                return;
+            }
+            if ( !true_consistent || !false_consistent ) {
+                int literal = true_consistent ? 2 * variable : 2 * variable + 1;
+                cube.push_back(literal);
+                if ( !lookahead.assume(literal) ) {
+                    cube.resize(cube_size);
+                    return;
+                }
+                forced = true;
+                continue;
+            }
+
+            unsigned long long score = ( assigned_true + 1ULL ) * ( assigned_false + 1ULL );
+            if ( score > best_score ) {
+                best_score = score;
+                best = variable;
+            }
+        }
+
+        // Forced literals change the propagation of the other candidates, probe them again
+        if ( forced ) best = -1;
+    }
+
+    if ( best < 0 ) {
+        cubes.push_back(cube);
+        cube.resize(cube_size);
+        return;
+    }
+
+    for ( int literal : { 2 * best, 2 * best + 1 } ) {
+        std::size_t level = lookahead.get_level();
+        lookahead.new_level();
+        cube.push_back(literal);
+        if ( lookahead.assume(literal) ) split(lookahead, depth - 1, cube, cubes);
+        cube.pop_back();
+        lookahead.backtrack(level);
+    }
+    cube.resize(cube_size);
+}
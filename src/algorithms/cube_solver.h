@@ -0,0 +1,121 @@
+/**
+ * @file cube_solver.h
+ * @brief Declares the cube_solver class, a cube-and-conquer SAT solver.
+ *
+ * This header file defines the `cube_solver` class, which inherits from the `solver` abstract base class.
+ * A lookahead phase splits the SAT problem into many cubes (partial assignments) by branching on the variables
+ * whose two values propagate the most, and a pool of workers solves the cubes with a DPLL search, stealing cubes
+ * from each other when their own queue runs dry. The first model found stops every worker.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef CUBE_SOLVER_H
+#define CUBE_SOLVER_H
+
+#pragma once
+
+#include "solver.h"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * @brief Cube-and-conquer solver for `sat_state` problems.
+ *
+ * Cubing: starting from the root, every node of the split tree probes both values of its most frequent free
+ * variables with unit propagation. A value that leads to a conflict is a failed literal and its negation is added
+ * to the cube; if both values fail, the node has no model and is dropped. Otherwise the node branches on the
+ * variable maximizing `(assigned if true + 1) * (assigned if false + 1)`, until the cube depth is reached.
+ *
+ * Conquering: every worker keeps its own copy of the clauses with two watched literals per clause and runs a
+ * DPLL search (unit propagation, chronological backtracking) under each cube. The cubes are dealt round-robin
+ * into per-worker deques; a worker takes from the back of its own deque and steals from the front of the others.
+ *
+ * The solver is complete: nullptr means the problem has no model (unless the search was stopped). The solution
+ * is the chain of `sat_state`s assigning the free variables in order, like the other solvers return it. Every
+ * decision and every lookahead probe counts as one expanded state.
+ */
+class cube_solver : public solver {
+public:
+    /**
+     * @brief Default number of cubes generated per worker when no depth is given.
+     */
+    static constexpr unsigned int CUBES_PER_WORKER = 16;
+
+    /**
+     * @brief Number of free variables probed at every node of the split tree.
+     */
+    static constexpr std::size_t LOOKAHEAD_CANDIDATES = 32;
+
+    /**
+     * @brief Constructor for the cube_solver class.
+     *
+     * @param initial_state The initial state of the problem, must be a `sat_state`.
+     * @param cube_depth The depth of the split tree (at most `2^cube_depth` cubes), 0 to derive it from the number
+     *                   of workers (`CUBES_PER_WORKER` cubes per worker).
+     * @throws std::invalid_argument if the initial state is not a SAT state.
+     */
+    explicit cube_solver ( const state_pointer initial_state, unsigned int cube_depth = 0 );
+
+    /**
+     * @brief Splits the problem into cubes and solves them one after another.
+     *
+     * @return A state_pointer to a satisfying assignment, or nullptr if there is none.
+     */
+    state_pointer solve_seq () override;
+
+    /**
+     * @brief Splits the problem into cubes and solves them on all OpenMP threads with work stealing.
+     *
+     * @return A state_pointer to a satisfying assignment, or nullptr if there is none.
+     */
+    state_pointer solve_par () override;
+
+    /**
+     * @brief Returns the number of cubes of the last search.
+     *
+     * @return The number of cubes left after the lookahead dropped the refuted ones.
+     */
+    [[nodiscard]] std::size_t get_num_cubes () const {
+        return num_cubes;
+    }
+
+private:
+    /**
+     * @brief Unit propagation and DPLL search over one copy of the clauses.
+     */
+    class engine;
+
+    /**
+     * @brief Splits the problem and solves the cubes.
+     *
+     * @param parallel If true, the cubes are solved on all OpenMP threads.
+     * @return A state_pointer to a satisfying assignment, or nullptr if there is none.
+     */
+    state_pointer search ( bool parallel );
+
+    /**
+     * @brief Builds the cubes below a node of the split tree.
+     *
+     * @param lookahead The engine holding the assignment of the node.
+     * @param depth The remaining depth of the split tree.
+     * @param cube The literals assigned on the way to the node.
+     * @param cubes Receives the cubes.
+     */
+    void split ( engine &lookahead, unsigned int depth, std::vector<int> &cube, std::vector<std::vector<int>> &cubes );
+
+    unsigned int cube_depth; ///< The depth of the split tree, 0 to derive it from the number of workers.
+    int num_variables = 0; ///< The number of variables.
+    std::vector<std::uint32_t> clause_starts; ///< Offset of every clause in `literals`, plus the end offset.
+    std::vector<int> literals; ///< The literals of all clauses, `2 * (variable - 1) + negated`.
+    std::vector<int> branch_order; ///< The free variables occurring in a clause, by decreasing number of occurrences.
+    bool contradiction = false; ///< Set if a clause has no literal.
+
+    std::atomic<bool> found { false }; ///< Set by the first worker that finds a model.
+    std::size_t num_cubes = 0; ///< The number of cubes of the last search.
+};
+
+#endif //CUBE_SOLVER_H
@@ -0,0 +1,461 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "dist_bfs_solver.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <omp.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#define DIST_BFS_SUPPORTED 1
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+dist_bfs_solver::dist_bfs_solver ( const state_pointer initial_state, int rank, int size, std::string endpoint )
+    : solver( initial_state ), rank( rank ), size( size ), endpoint( std::move(endpoint) ) {
+    if ( size < 1 || rank < 0 || rank >= size ) throw std::invalid_argument("Distributed BFS rank must be between 0 and size - 1.");
+    if ( this->endpoint.empty() ) throw std::invalid_argument("Distributed BFS needs an endpoint.");
+}
+
+state_pointer dist_bfs_solver::solve_seq () {
+    return search( false );
+}
+
+state_pointer dist_bfs_solver::solve_par () {
+    return search( true );
+}
+
+int dist_bfs_solver::get_owner ( std::uint64_t identifier, int size ) {
+    // splitmix64 finalizer, identifiers are often sequential
+    identifier ^= identifier >> 30;
+    identifier *= 0xbf58476d1ce4e5b9ULL;
+    identifier ^= identifier >> 27;
+    identifier *= 0x94d049bb133111ebULL;
+    identifier ^= identifier >> 31;
+    return static_cast<int>(identifier % static_cast<std::uint64_t>(size));
+}
+
+/**
+ * @brief Appends an integer to a message in host byte order (all ranks are expected to share the architecture).
+ */
+static void append_integer ( std::string &message, std::uint64_t value ) {
+    message.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * @brief Reads an integer written by `append_integer`.
+ */
+static std::uint64_t read_integer ( const std::string &message, std::size_t offset ) {
+    if ( offset + sizeof(std::uint64_t) > message.size() ) throw std::runtime_error("Distributed BFS received a truncated message.");
+    std::uint64_t value;
+    std::memcpy(&value, message.data() + offset, sizeof(value));
+    return value;
+}
+
+#ifdef DIST_BFS_SUPPORTED
+
+/**
+ * @brief The full mesh of sockets between the ranks, one connection per pair.
+ */
+struct dist_bfs_solver::mesh {
+    int rank;
+    int size;
+    int listener = -1;
+    std::string unix_path; ///< The socket file to remove, empty for TCP.
+    std::vector<int> sockets; ///< The connection to each rank, -1 for this rank.
+
+    mesh ( int rank, int size, const std::string &endpoint ) : rank( rank ), size( size ), sockets( size, -1 ) {
+        try {
+            connect_all(endpoint);
+        } catch ( ... ) {
+            close_all();
+            throw;
+        }
+    }
+
+    ~mesh () {
+        close_all();
+    }
+
+    mesh ( const mesh& ) = delete;
+    mesh &operator= ( const mesh& ) = delete;
+
+    /**
+     * @brief Sends one message to every peer and receives one message from every peer.
+     *
+     * All transfers progress together, so ranks sending large batches to each other cannot block one another.
+     * Messages are framed by their length; exactly one frame is read per peer, later frames stay queued.
+     *
+     * @param outgoing The message for each rank, the entry of this rank is ignored.
+     * @return The message from each rank, the entry of this rank is empty.
+     */
+    std::vector<std::string> exchange ( const std::vector<std::string> &outgoing ) {
+        std::vector<std::string> frames(size), incoming(size);
+        std::vector<std::size_t> sent(size, 0), received(size, 0);
+        std::vector<std::uint64_t> lengths(size, 0);
+        std::vector<char> header_done(size, 0);
+        std::vector<std::string> headers(size, std::string(sizeof(std::uint64_t), '\0'));
+
+        for ( int peer = 0; peer < size; ++peer ) {
+            if ( peer == rank ) continue;
+            append_integer(frames[peer], outgoing[peer].size());
+            frames[peer] += outgoing[peer];
+        }
+
+        while ( true ) {
+            std::vector<pollfd> descriptors;
+            std::vector<int> peers;
+            for ( int peer = 0; peer < size; ++peer ) {
+                if ( peer == rank ) continue;
+                short events = 0;
+                if ( sent[peer] < frames[peer].size() ) events |= POLLOUT;
+                if ( !header_done[peer] || received[peer] < lengths[peer] ) events |= POLLIN;
+                if ( events == 0 ) continue;
+                descriptors.push_back({ sockets[peer], events, 0 });
+                peers.push_back(peer);
+            }
+            if ( descriptors.empty() ) break;
+
+            if ( poll(descriptors.data(), descriptors.size(), -1) < 0 ) {
+                if ( errno == EINTR ) continue;
+                throw std::runtime_error("Distributed BFS poll failed: " + std::string(std::strerror(errno)));
+            }
+
+            for ( std::size_t i = 0; i < descriptors.size(); ++i ) {
+                int peer = peers[i];
+                if ( descriptors[i].revents & POLLOUT ) {
+                    ssize_t count = send(sockets[peer], frames[peer].data() + sent[peer], frames[peer].size() - sent[peer], MSG_NOSIGNAL);
+                    if ( count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR ) {
+                        throw std::runtime_error("Distributed BFS lost rank " + std::to_string(peer) + ": " + std::strerror(errno));
+                    }
+                    if ( count > 0 ) sent[peer] += count;
+                }
+                if ( descriptors[i].revents & ( POLLIN | POLLHUP | POLLERR ) ) receive(peer, headers[peer], header_done[peer], lengths[peer], incoming[peer], received[peer]);
+            }
+        }
+        return incoming;
+    }
+
+private:
+    /**
+     * @brief Reads the available part of the frame of one peer.
+     */
+    void receive ( int peer, std::string &header, char &header_done, std::uint64_t &length, std::string &message, std::size_t &received ) {
+        char *target;
+        std::size_t wanted;
+        if ( !header_done ) {
+            target = header.data() + received;
+            wanted = header.size() - received;
+        } else {
+            target = message.data() + received;
+            wanted = length - received;
+        }
+        if ( wanted == 0 ) return;
+
+        ssize_t count = recv(sockets[peer], target, wanted, 0);
+        if ( count == 0 ) throw std::runtime_error("Distributed BFS lost rank " + std::to_string(peer) + ": connection closed.");
+        if ( count < 0 ) {
+            if ( errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ) return;
+            throw std::runtime_error("Distributed BFS lost rank " + std::to_string(peer) + ": " + std::strerror(errno));
+        }
+        received += count;
+
+        if ( !header_done && received == header.size() ) {
+            header_done = 1;
+            length = read_integer(header, 0);
+            message.assign(length, '\0');
+            received = 0;
+        }
+    }
+
+    /**
+     * @brief Resolves the address of a rank from the endpoint description.
+     */
+    sockaddr_storage resolve ( const std::string &endpoint, int target, socklen_t &length ) const {
+        sockaddr_storage address {};
+        if ( endpoint.compare(0, 4, "tcp:") != 0 ) {
+            std::string path = ( endpoint.compare(0, 5, "unix:") == 0 ? endpoint.substr(5) : endpoint ) + "." + std::to_string(target);
+            auto *unix_address = reinterpret_cast<sockaddr_un*>(&address);
+            if ( path.size() >= sizeof(unix_address->sun_path) ) throw std::invalid_argument("Socket path is too long: " + path);
+            unix_address->sun_family = AF_UNIX;
+            std::strncpy(unix_address->sun_path, path.c_str(), sizeof(unix_address->sun_path) - 1);
+            length = sizeof(sockaddr_un);
+            return address;
+        }
+
+        // "tcp:host:port" for consecutive ports on one host, or one "host:port" per rank separated by commas
+        std::vector<std::string> addresses;
+        std::string list = endpoint.substr(4);
+        for ( std::size_t start = 0; start <= list.size(); ) {
+            std::size_t end = list.find(',', start);
+            if ( end == std::string::npos ) end = list.size();
+            addresses.push_back(list.substr(start, end - start));
+            start = end + 1;
+        }
+        if ( addresses.size() != 1 && static_cast<int>(addresses.size()) != size ) throw std::invalid_argument("Endpoint must list one address or one address per rank.");
+
+        const std::string &entry = addresses.size() == 1 ? addresses[0] : addresses[target];
+        std::size_t separator = entry.rfind(':');
+        if ( separator == std::string::npos ) throw std::invalid_argument("Expected host:port, got: " + entry);
+        std::string host = entry.substr(0, separator);
+        int port = std::stoi(entry.substr(separator + 1)) + ( addresses.size() == 1 ? target : 0 );
+
+        addrinfo hints {};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo *result = nullptr;
+        int status = getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &result);
+        if ( status != 0 ) throw std::runtime_error("Failed to resolve " + host + ": " + gai_strerror(status));
+        std::memcpy(&address, result->ai_addr, result->ai_addrlen);
+        length = result->ai_addrlen;
+        freeaddrinfo(result);
+        return address;
+    }
+
+    /**
+     * @brief Listens on the endpoint of this rank, connects to the lower ranks and accepts the higher ones.
+     */
+    void connect_all ( const std::string &endpoint ) {
+        socklen_t length;
+        sockaddr_storage own = resolve(endpoint, rank, length);
+
+        listener = socket(own.ss_family, SOCK_STREAM, 0);
+        if ( listener < 0 ) throw std::runtime_error("Failed to create socket: " + std::string(std::strerror(errno)));
+        if ( own.ss_family == AF_UNIX ) {
+            unix_path = reinterpret_cast<sockaddr_un*>(&own)->sun_path;
+            unlink(unix_path.c_str());
+        } else {
+            int enable = 1;
+            setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+        }
+        if ( bind(listener, reinterpret_cast<sockaddr*>(&own), length) != 0 || listen(listener, size) != 0 ) {
+            throw std::runtime_error("Failed to listen on the endpoint of rank " + std::to_string(rank) + ": " + std::strerror(errno));
+        }
+
+        // The peers start at different times, keep retrying for a while
+        for ( int peer = 0; peer < rank; ++peer ) {
+            sockaddr_storage address = resolve(endpoint, peer, length);
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+            while ( true ) {
+                int connection = socket(address.ss_family, SOCK_STREAM, 0);
+                if ( connection < 0 ) throw std::runtime_error("Failed to create socket: " + std::string(std::strerror(errno)));
+                if ( connect(connection, reinterpret_cast<sockaddr*>(&address), length) == 0 ) {
+                    sockets[peer] = connection;
+                    break;
+                }
+                close(connection);
+                if ( std::chrono::steady_clock::now() > deadline ) throw std::runtime_error("Failed to connect to rank " + std::to_string(peer) + ".");
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+            std::uint32_t hello = rank;
+            if ( send(sockets[peer], &hello, sizeof(hello), MSG_NOSIGNAL) != sizeof(hello) ) throw std::runtime_error("Failed to greet rank " + std::to_string(peer) + ".");
+        }
+
+        for ( int accepted = rank + 1; accepted < size; ++accepted ) {
+            int connection = accept(listener, nullptr, nullptr);
+            if ( connection < 0 ) throw std::runtime_error("Failed to accept a peer: " + std::string(std::strerror(errno)));
+            std::uint32_t hello = 0;
+            if ( recv(connection, &hello, sizeof(hello), MSG_WAITALL) != sizeof(hello) || static_cast<int>(hello) <= rank
+                 || static_cast<int>(hello) >= size || sockets[hello] != -1 ) {
+                close(connection);
+                throw std::runtime_error("Unexpected peer connected to rank " + std::to_string(rank) + ".");
+            }
+            sockets[hello] = connection;
+        }
+
+        for ( int peer = 0; peer < size; ++peer ) {
+            if ( sockets[peer] < 0 ) continue;
+            fcntl(sockets[peer], F_SETFL, fcntl(sockets[peer], F_GETFL) | O_NONBLOCK);
+            if ( own.ss_family != AF_UNIX ) {
+                int enable = 1;
+                setsockopt(sockets[peer], IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+            }
+        }
+    }
+
+    void close_all () {
+        for ( int &connection : sockets ) {
+            if ( connection >= 0 ) close(connection);
+            connection = -1;
+        }
+        if ( listener >= 0 ) close(listener);
+        listener = -1;
+        if ( !unix_path.empty() ) unlink(unix_path.c_str());
+    }
+};
+
+state_pointer dist_bfs_solver::search ( bool parallel ) {
+    expanded_states = 0;
+    mesh connections(rank, size, endpoint);
+
+    // Visited states of the slice of this rank
+    struct visited_entry {
+        std::uint64_t parent;
+        std::string encoding;
+        bool is_root;
+    };
+    std::unordered_map<std::uint64_t, visited_entry> visited;
+
+    std::vector<state_pointer> frontier;
+    const std::size_t encoding_size = root->encode().size();
+    const std::size_t record_size = 2 * sizeof(std::uint64_t) + encoding_size;
+    std::uint64_t goal_identifier = root->get_identifier();
+    bool goal_found = root->is_goal();
+
+    if ( get_owner(root->get_identifier(), size) == rank ) {
+        visited.emplace(root->get_identifier(), visited_entry { 0, root->encode(), true });
+        frontier.push_back(root);
+    }
+
+    for ( std::uint64_t level = 0; !goal_found; ++level ) {
+        // Children grouped by owner, each batch starts with the level it belongs to
+        std::vector<std::string> outgoing(size);
+        for ( std::string &batch : outgoing ) append_integer(batch, level);
+
+        std::exception_ptr error = nullptr;
+        auto append_children = [&]( const state_pointer &current, std::vector<std::string> &batches ) {
+            std::uint64_t parent = current->get_identifier();
+            for ( const state_pointer &child : current->get_descendents() ) {
+                std::uint64_t identifier = child->get_identifier();
+                std::string encoding = child->encode();
+                if ( encoding.size() != encoding_size ) throw std::logic_error("All states of a problem must encode to the same size.");
+                std::string &batch = batches[get_owner(identifier, size)];
+                append_integer(batch, identifier);
+                append_integer(batch, parent);
+                batch += encoding;
+            }
+        };
+
+        if ( parallel ) {
+            #pragma omp parallel
+            {
+                std::vector<std::string> local(size);
+                #pragma omp for schedule(dynamic, 64)
+                for ( std::size_t i = 0; i < frontier.size(); ++i ) {
+                    if ( stop_requested ) continue;
+                    try {
+                        append_children(frontier[i], local);
+                    } catch ( ... ) {
+                        #pragma omp critical
+                        error = std::current_exception();
+                    }
+                }
+                #pragma omp critical
+                for ( int peer = 0; peer < size; ++peer ) outgoing[peer] += local[peer];
+            }
+            if ( error ) std::rethrow_exception(error);
+        } else {
+            for ( const state_pointer &current : frontier ) {
+                if ( stop_requested ) break;
+                append_children(current, outgoing);
+            }
+        }
+        std::uint64_t local_expanded = frontier.size();
+
+        std::vector<std::string> incoming = connections.exchange(outgoing);
+        incoming[rank] = std::move(outgoing[rank]);
+
+        std::vector<state_pointer> next;
+        std::uint64_t local_goal = ~std::uint64_t(0);
+        for ( const std::string &batch : incoming ) {
+            if ( read_integer(batch, 0) != level ) throw std::runtime_error("Distributed BFS received a message of another level.");
+            if ( ( batch.size() - sizeof(std::uint64_t) ) % record_size != 0 ) throw std::runtime_error("Distributed BFS received a truncated message.");
+
+            for ( std::size_t offset = sizeof(std::uint64_t); offset < batch.size(); offset += record_size ) {
+                std::uint64_t identifier = read_integer(batch, offset);
+                std::string encoding = batch.substr(offset + 2 * sizeof(std::uint64_t), encoding_size);
+                auto [entry, inserted] = visited.emplace(identifier, visited_entry { read_integer(batch, offset + sizeof(std::uint64_t)), encoding, false });
+                if ( !inserted ) continue;
+
+                state_pointer decoded = root->decode(encoding, nullptr);
+                if ( decoded->is_goal() ) local_goal = std::min(local_goal, identifier);
+                next.push_back(std::move(decoded));
+            }
+        }
+
+        // Agree on the outcome of the level: next level size, smallest goal, expanded states and stop requests
+        std::string summary;
+        append_integer(summary, level);
+        append_integer(summary, next.size());
+        append_integer(summary, local_goal);
+        append_integer(summary, local_expanded);
+        append_integer(summary, stop_requested ? 1 : 0);
+
+        std::vector<std::string> summaries = connections.exchange(std::vector<std::string>(size, summary));
+        summaries[rank] = summary;
+
+        std::uint64_t next_total = 0, expanded_total = 0;
+        std::uint64_t best_goal = ~std::uint64_t(0);
+        bool stopped = false;
+        for ( const std::string &peer_summary : summaries ) {
+            if ( read_integer(peer_summary, 0) != level ) throw std::runtime_error("Distributed BFS received a message of another level.");
+            next_total += read_integer(peer_summary, 8);
+            best_goal = std::min(best_goal, read_integer(peer_summary, 16));
+            expanded_total += read_integer(peer_summary, 24);
+            stopped = stopped || read_integer(peer_summary, 32) != 0;
+        }
+        expanded_states += expanded_total;
+        goal_found = best_goal != ~std::uint64_t(0);
+        goal_identifier = best_goal;
+
+        if ( stopped || ( !goal_found && next_total == 0 ) ) return nullptr;
+        frontier.swap(next);
+    }
+
+    if ( root->is_goal() ) return root;
+
+    // Trace the path back, one step per round: the owner of the current state broadcasts its entry
+    std::vector<std::string> encodings;
+    std::uint64_t current = goal_identifier;
+    while ( true ) {
+        int owner = get_owner(current, size);
+        std::string entry;
+        if ( owner == rank ) {
+            const visited_entry &found = visited.at(current);
+            append_integer(entry, found.is_root ? 1 : 0);
+            append_integer(entry, found.parent);
+            entry += found.encoding;
+        }
+
+        std::vector<std::string> received = connections.exchange(std::vector<std::string>(size, entry));
+        if ( owner != rank ) entry = received[owner];
+
+        if ( read_integer(entry, 0) != 0 ) break;
+        current = read_integer(entry, 8);
+        encodings.push_back(entry.substr(2 * sizeof(std::uint64_t)));
+    }
+
+    state_pointer solution = root;
+    for ( auto encoding = encodings.rbegin(); encoding != encodings.rend(); ++encoding ) {
+        solution = root->decode(*encoding, solution);
+    }
+    return solution;
+}
+
+#else
+
+state_pointer dist_bfs_solver::search ( bool parallel ) {
+    (void) parallel;
+    throw std::runtime_error("Distributed BFS is not supported on this platform.");
+}
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * @file dist_bfs_solver.h
+ * @brief Declares the dist_bfs_solver class, a Breadth-First Search distributed between cooperating processes.
+ *
+ * This header file defines the `dist_bfs_solver` class, which inherits from the `solver` abstract base class.
+ * Several processes, possibly on different machines, run the same solve on the same problem. Each process
+ * (rank) owns the slice of the identifier space that hashes to it, keeps the visited states of its slice and
+ * expands them. The ranks are connected by a full mesh of TCP or Unix domain sockets and exchange batched,
+ * level-tagged messages; the exchange at the end of every level doubles as the level barrier.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef DIST_BFS_SOLVER_H
+#define DIST_BFS_SOLVER_H
+
+#pragma once
+
+#include "solver.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+/**
+ * @brief Level-synchronous BFS split between processes connected by sockets.
+ *
+ * States are sent to their owners in their `state::encode` form, so the problem must support encoding.
+ * Each level the ranks expand their part of the frontier, send every child to its owner in one batch per
+ * peer, deduplicate the received states against their visited slice and agree on the size of the next level,
+ * the goal with the smallest identifier and the number of expanded states. The solution path is traced back
+ * across the owners of its states, so every rank returns the same solution.
+ *
+ * Endpoints:
+ *   - `unix:<prefix>` (or just `<prefix>`) - rank `r` listens on the Unix domain socket `<prefix>.<r>`.
+ *   - `tcp:<host>:<port>` - rank `r` listens on `<host>:<port + r>`.
+ *   - `tcp:<host0>:<port0>,<host1>:<port1>,...` - rank `r` listens on the `r`-th address.
+ */
+class dist_bfs_solver : public solver {
+public:
+    /**
+     * @brief Constructor for the dist_bfs_solver class.
+     *
+     * @param initial_state The initial state of the problem, the same in every rank.
+     * @param rank The index of this process, from 0 to `size - 1`.
+     * @param size The number of cooperating processes.
+     * @param endpoint The endpoint description shared by all ranks.
+     * @throws std::invalid_argument if the initial state is null, the rank is out of range or the endpoint is empty.
+     */
+    dist_bfs_solver ( const state_pointer initial_state, int rank, int size, std::string endpoint );
+
+    /**
+     * @brief Solves the problem, expanding the local frontier on one thread.
+     *
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     * @throws std::runtime_error if the mesh cannot be set up, a peer disconnects or the platform is not supported.
+     */
+    state_pointer solve_seq () override;
+
+    /**
+     * @brief Solves the problem, expanding the local frontier with OpenMP.
+     *
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     * @throws std::runtime_error if the mesh cannot be set up, a peer disconnects or the platform is not supported.
+     */
+    state_pointer solve_par () override;
+
+    /**
+     * @brief Returns the rank owning an identifier.
+     *
+     * @param identifier The identifier of a state.
+     * @param size The number of ranks.
+     * @return The owning rank.
+     */
+    static int get_owner ( std::uint64_t identifier, int size );
+
+private:
+    struct mesh;
+
+    /**
+     * @brief Runs the distributed search.
+     *
+     * @param parallel If true, the local frontier is expanded with OpenMP.
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     */
+    state_pointer search ( bool parallel );
+
+    int rank; ///< The index of this process.
+    int size; ///< The number of cooperating processes.
+    std::string endpoint; ///< The endpoint description shared by all ranks.
+};
+
+#endif //DIST_BFS_SOLVER_H
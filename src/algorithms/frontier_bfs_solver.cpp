@@ -0,0 +1,138 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "frontier_bfs_solver.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <omp.h>
+
+namespace {
+    /**
+     * @brief Copies a state without its predecessor, so storing it does not keep its ancestors alive.
+     */
+    state_pointer detach ( const state_pointer &state ) {
+        return state->decode(state->encode(), nullptr);
+    }
+}
+
+state_pointer frontier_bfs_solver::solve_seq () {
+    return search(false);
+}
+
+state_pointer frontier_bfs_solver::solve_par () {
+    return search(true);
+}
+
+state_pointer frontier_bfs_solver::search ( bool parallel ) {
+    expanded_states = 0;
+    peak_stored_states = 0;
+
+    if ( root->is_goal() ) return root;
+
+    state_pointer start = detach(root);
+    sweep_result goal = sweep(start, []( const state_pointer &state ) { return state->is_goal(); }, 0, parallel);
+    if ( goal.target == nullptr ) return nullptr;
+
+    std::vector<unsigned long long> path;
+    path.reserve(goal.depth);
+    if ( !reconstruct(start, goal.target, goal.depth, parallel, path) ) return nullptr;
+
+    // Replay the path from the initial state so the solution is linked to its predecessors
+    state_pointer current = root;
+    for ( unsigned long long identifier : path ) {
+        state_pointer next = nullptr;
+        for ( const state_pointer &child : current->get_descendents() ) {
+            if ( child->get_identifier() == identifier ) {
+                next = child;
+                break;
+            }
+        }
+        if ( next == nullptr ) throw std::logic_error("Frontier search rebuilt a path with a missing move.");
+        current = std::move(next);
+    }
+    return current;
+}
+
+bool frontier_bfs_solver::reconstruct ( const state_pointer &from, const state_pointer &to, unsigned long long distance, bool parallel,
+                                        std::vector<unsigned long long> &path ) {
+    if ( distance == 0 ) return true;
+    if ( distance == 1 ) {
+        path.push_back(to->get_identifier());
+        return true;
+    }
+
+    unsigned long long target = to->get_identifier();
+    unsigned long long midpoint = distance / 2;
+    sweep_result result = sweep(from, [target]( const state_pointer &state ) { return state->get_identifier() == target; }, midpoint, parallel);
+    if ( stop_requested ) return false;
+    if ( result.target == nullptr || result.depth != distance || result.relay == nullptr ) {
+        throw std::logic_error("Frontier search could not find the midpoint of the path, are the moves reversible?");
+    }
+
+    return reconstruct(from, result.relay, midpoint, parallel, path)
+        && reconstruct(result.relay, to, distance - midpoint, parallel, path);
+}
+
+frontier_bfs_solver::sweep_result frontier_bfs_solver::sweep ( const state_pointer &start, const std::function<bool ( const state_pointer& )> &is_target,
+                                                               unsigned long long relay_depth, bool parallel ) {
+    level previous;
+    level current;
+    current[start->get_identifier()] = { start, nullptr };
+    unsigned long long depth = 0;
+
+    while ( !current.empty() && !stop_requested ) {
+        // Only the children not in the previous or current level are kept, the next level dedupes the rest
+        std::vector<std::pair<unsigned long long, level_entry>> children;
+        std::vector<const level_entry*> expanding;
+        expanding.reserve(current.size());
+        for ( const auto &[identifier, entry] : current ) expanding.push_back(&entry);
+        bool at_relay = depth + 1 == relay_depth;
+        unsigned long long expanded = 0;
+
+        #pragma omp parallel if ( parallel )
+        {
+            std::vector<std::pair<unsigned long long, level_entry>> local_children;
+
+            #pragma omp for schedule(dynamic, 64) reduction(+:expanded)
+            for ( size_t i = 0; i < expanding.size(); ++i ) {
+                if ( stop_requested ) continue;
+                ++expanded;
+                for ( const state_pointer &child : expanding[i]->state->get_descendents() ) {
+                    unsigned long long identifier = child->get_identifier();
+                    if ( previous.count(identifier) || current.count(identifier) ) continue;
+
+                    state_pointer stored = detach(child);
+                    state_pointer relay = at_relay ? stored : expanding[i]->relay;
+                    local_children.emplace_back(identifier, level_entry { std::move(stored), std::move(relay) });
+                }
+            }
+
+            #pragma omp critical
+            children.insert(children.end(), std::make_move_iterator(local_children.begin()), std::make_move_iterator(local_children.end()));
+        }
+
+        expanded_states += expanded;
+        ++depth;
+
+        level next;
+        next.reserve(children.size());
+        sweep_result result;
+        for ( auto &[identifier, entry] : children ) {
+            auto [stored, inserted] = next.try_emplace(identifier, std::move(entry));
+            if ( !inserted || !is_target(stored->second.state) ) continue;
+            if ( result.target == nullptr || identifier < result.target->get_identifier() ) {
+                result = { stored->second.state, stored->second.relay, depth };
+            }
+        }
+
+        peak_stored_states = std::max(peak_stored_states, previous.size() + current.size() + next.size());
+        if ( result.target != nullptr ) return result;
+
+        previous = std::exchange(current, std::move(next));
+    }
+
+    return {};
+}
@@ -0,0 +1,135 @@
+/**
+ * @file frontier_bfs_solver.h
+ * @brief Declares the frontier_bfs_solver class, a Breadth-First Search that keeps no closed list.
+ *
+ * This header file defines the `frontier_bfs_solver` class, which inherits from the `solver` abstract base class.
+ * It implements Korf's breadth-first frontier search: only the previous, current and next BFS levels are stored,
+ * everything older is freed, and the solution path is rebuilt by divide and conquer through midpoint states.
+ * Peak memory drops from the whole explored space to about the three widest consecutive levels.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef FRONTIER_BFS_SOLVER_H
+#define FRONTIER_BFS_SOLVER_H
+
+#pragma once
+
+#include "solver.h"
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+
+/**
+ * @brief Frontier search with divide-and-conquer path reconstruction.
+ *
+ * In a problem whose moves can be undone (maze, Hanoi) or whose states form a tree (SAT), every neighbour of a
+ * state at depth `d` lies at depth `d - 1`, `d` or `d + 1`, so checking the children against these three levels
+ * finds every duplicate. Stored states are detached from their predecessors through `state::encode` and
+ * `state::decode`, so the problem must support encoding.
+ *
+ * The first sweep only finds the depth `D` of the nearest goal. A path from `s` to `t` at distance `L` is then
+ * rebuilt by sweeping from `s` to `t` while every state deeper than `L / 2` carries its ancestor at depth `L / 2`.
+ * That midpoint splits the path into two halves solved recursively, so the reconstruction re-expands about
+ * `log2(D)` times the states of the first sweep. The expanded states count includes all sweeps.
+ *
+ * On problems with one-way moves older states can be generated again; the answer is still a shortest path,
+ * but a problem without a solution may only end through `request_stop`.
+ */
+class frontier_bfs_solver : public solver {
+public:
+    /**
+     * @brief Constructor for the frontier_bfs_solver class.
+     *
+     * @param initial_state The initial state of the problem.
+     */
+    explicit frontier_bfs_solver ( const state_pointer initial_state ) : solver( initial_state ) {}
+
+    /**
+     * @brief Solves the problem sequentially using frontier search.
+     *
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     * @throws std::logic_error if the problem does not support state encoding.
+     */
+    state_pointer solve_seq () override;
+
+    /**
+     * @brief Solves the problem using frontier search, expanding each level in parallel.
+     *
+     * This implementation uses OpenMP for parallel execution.
+     *
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     * @throws std::logic_error if the problem does not support state encoding.
+     */
+    state_pointer solve_par () override;
+
+    /**
+     * @brief Returns the largest number of states stored at once by the last search.
+     *
+     * @return The peak size of the previous, current and next levels together.
+     */
+    [[nodiscard]] std::size_t get_peak_stored_states () const {
+        return peak_stored_states;
+    }
+
+private:
+    /**
+     * @brief A stored state and its ancestor at the midpoint depth.
+     */
+    struct level_entry {
+        state_pointer state; ///< The state, detached from its predecessor.
+        state_pointer relay; ///< The ancestor at the midpoint depth, nullptr above it.
+    };
+
+    using level = std::unordered_map<unsigned long long, level_entry>;
+
+    /**
+     * @brief The outcome of one sweep.
+     */
+    struct sweep_result {
+        state_pointer target = nullptr; ///< The target found, nullptr if none was found.
+        state_pointer relay = nullptr; ///< The ancestor of the target at the midpoint depth.
+        unsigned long long depth = 0; ///< The depth of the target.
+    };
+
+    /**
+     * @brief Runs frontier search from a state until a target is generated.
+     *
+     * @param start The state to search from, detached from its predecessor.
+     * @param is_target The target test, the target with the smallest identifier of its level is returned.
+     * @param relay_depth The midpoint depth whose states are carried by their descendants, 0 for none.
+     * @param parallel If true, each level is expanded with OpenMP.
+     * @return The target, its midpoint ancestor and its depth.
+     */
+    sweep_result sweep ( const state_pointer &start, const std::function<bool ( const state_pointer& )> &is_target,
+                         unsigned long long relay_depth, bool parallel );
+
+    /**
+     * @brief Appends the identifiers of the states on a shortest path after `from` up to `to`.
+     *
+     * @param from The first state of the path, detached from its predecessor.
+     * @param to The last state of the path, detached from its predecessor.
+     * @param distance The number of moves between the two states.
+     * @param parallel If true, the sweeps expand each level with OpenMP.
+     * @param path The identifiers, in order.
+     * @return `false` if the search was stopped.
+     * @throws std::logic_error if a sweep does not find `to` at `distance` moves.
+     */
+    bool reconstruct ( const state_pointer &from, const state_pointer &to, unsigned long long distance, bool parallel,
+                       std::vector<unsigned long long> &path );
+
+    /**
+     * @brief Runs the search and rebuilds the solution from the initial state.
+     *
+     * @param parallel If true, each level is expanded with OpenMP.
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     */
+    state_pointer search ( bool parallel );
+
+    std::size_t peak_stored_states = 0; ///< The largest number of states stored at once.
+};
+
+#endif //FRONTIER_BFS_SOLVER_H
@@ -0,0 +1,131 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "gray_code_solver.h"
+#include "../generators/sat_generator.h"
+#include "../preprocessing/sat_preprocessor.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <omp.h>
+
+gray_code_solver::gray_code_solver ( const state_pointer initial_state ) : solver( initial_state ) {
+    const auto *sat = dynamic_cast<const sat_state*>(root.get());
+    if ( sat == nullptr ) throw std::invalid_argument("Gray code search needs a SAT problem.");
+
+    sat_problem problem = sat->get_problem();
+    std::map<int, bool> assignment = sat->get_assignment();
+
+    // Count the occurrences of the free variables in the clauses left by the initial assignment
+    sat_flat_clauses flat = sat_preprocessor::flatten(problem, assignment);
+    contradiction = flat.contradiction;
+    std::vector<std::size_t> counts(problem.num_variables, 0);
+    for ( int literal : flat.literals ) ++counts[literal >> 1];
+
+    // Bit i flips every 2^(i+1) steps, so the least frequent variables get the lowest bits
+    for ( int variable = 0; variable < problem.num_variables; ++variable ) {
+        if ( counts[variable] > 0 ) variables.push_back(variable);
+    }
+    if ( static_cast<int>(variables.size()) > MAX_VARIABLES ) throw std::invalid_argument("Gray code search supports at most " + std::to_string(MAX_VARIABLES) + " free variables.");
+    std::stable_sort(variables.begin(), variables.end(), [&counts]( int a, int b ) { return counts[a] < counts[b]; });
+    std::vector<int> bits(problem.num_variables, -1);
+    for ( std::size_t bit = 0; bit < variables.size(); ++bit ) bits[variables[bit]] = static_cast<int>(bit);
+
+    std::vector<std::vector<std::uint32_t>> literal_clauses(2 * variables.size());
+    for ( std::uint32_t clause = 0; clause + 1 < flat.clause_starts.size(); ++clause ) {
+        std::uint64_t clause_positive = 0, clause_negative = 0;
+        for ( std::uint32_t i = flat.clause_starts[clause]; i < flat.clause_starts[clause + 1]; ++i ) {
+            ( flat.literals[i] & 1 ? clause_negative : clause_positive ) |= std::uint64_t(1) << bits[flat.literals[i] >> 1];
+        }
+        positive.push_back(clause_positive);
+        negative.push_back(clause_negative);
+        for ( std::uint64_t mask = clause_positive; mask != 0; mask &= mask - 1 ) literal_clauses[2 * std::countr_zero(mask)].push_back(clause);
+        for ( std::uint64_t mask = clause_negative; mask != 0; mask &= mask - 1 ) literal_clauses[2 * std::countr_zero(mask) + 1].push_back(clause);
+    }
+
+    occurrence_starts.push_back(0);
+    for ( const auto &clauses : literal_clauses ) {
+        occurrences.insert(occurrences.end(), clauses.begin(), clauses.end());
+        occurrence_starts.push_back(static_cast<std::uint32_t>(occurrences.size()));
+    }
+}
+
+state_pointer gray_code_solver::solve_seq () {
+    return search(false);
+}
+
+state_pointer gray_code_solver::solve_par () {
+    return search(true);
+}
+
+state_pointer gray_code_solver::search ( bool parallel ) {
+    expanded_states = 0;
+    found = false;
+
+    if ( contradiction ) return nullptr;
+
+    std::uint64_t steps = std::uint64_t(1) << variables.size();
+    std::uint64_t ranges = parallel ? std::min<std::uint64_t>(steps, static_cast<std::uint64_t>(omp_get_max_threads()) * RANGES_PER_THREAD) : 1;
+    std::uint64_t range_size = steps / ranges;
+    std::uint64_t remainder = steps % ranges;
+    std::uint64_t model = 0;
+
+    #pragma omp parallel if ( parallel )
+    {
+        std::vector<std::uint32_t> true_count(positive.size());
+        std::uint64_t local_model = 0;
+
+        #pragma omp for schedule(dynamic, 1)
+        for ( std::uint64_t range = 0; range < ranges; ++range ) {
+            if ( found || stop_requested ) continue;
+            std::uint64_t begin = range * range_size + std::min(range, remainder);
+            std::uint64_t end = begin + range_size + ( range < remainder ? 1 : 0 );
+            if ( search_range(begin, end, true_count, local_model) && !found.exchange(true) ) model = local_model;
+        }
+    }
+
+    if ( !found ) return nullptr;
+
+    std::vector<std::uint8_t> values(static_cast<const sat_state&>(*root).get_problem().num_variables, 0);
+    for ( std::size_t bit = 0; bit < variables.size(); ++bit ) values[variables[bit]] = ( model >> bit ) & 1;
+    return static_cast<const sat_state&>(*root).assign_remaining(values);
+}
+
+bool gray_code_solver::search_range ( std::uint64_t begin, std::uint64_t end, std::vector<std::uint32_t> &true_count, std::uint64_t &model ) {
+    // Evaluate every clause at the first assignment of the range
+    std::uint64_t assignment = begin ^ ( begin >> 1 );
+    std::size_t unsatisfied = 0;
+    for ( std::size_t clause = 0; clause < positive.size(); ++clause ) {
+        true_count[clause] = static_cast<std::uint32_t>(std::popcount(assignment & positive[clause]) + std::popcount(~assignment & negative[clause]));
+        if ( true_count[clause] == 0 ) ++unsatisfied;
+    }
+
+    std::uint64_t step = begin;
+    std::uint64_t reported = begin; // The steps before it are counted in expanded_states
+    while ( unsatisfied > 0 ) {
+        if ( ++step == end ) break;
+        if ( step % CHECK_INTERVAL == 0 ) {
+            expanded_states += step - reported;
+            reported = step;
+            if ( found || stop_requested ) return false;
+        }
+
+        // The clauses of the literal that becomes true gain a true literal, those of its negation lose one
+        int bit = std::countr_zero(step);
+        assignment ^= std::uint64_t(1) << bit;
+        int made_true = 2 * bit + ( ( assignment >> bit ) & 1 ? 0 : 1 );
+        for ( std::uint32_t i = occurrence_starts[made_true]; i < occurrence_starts[made_true + 1]; ++i ) {
+            if ( true_count[occurrences[i]]++ == 0 ) --unsatisfied;
+        }
+        int made_false = made_true ^ 1;
+        for ( std::uint32_t i = occurrence_starts[made_false]; i < occurrence_starts[made_false + 1]; ++i ) {
+            if ( --true_count[occurrences[i]] == 0 ) ++unsatisfied;
+        }
+    }
+
+    expanded_states += ( unsatisfied == 0 ? step + 1 : step ) - reported;
+    model = assignment;
+    return unsatisfied == 0;
+}
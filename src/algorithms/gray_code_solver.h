@@ -0,0 +1,108 @@
+/**
+ * @file gray_code_solver.h
+ * @brief Declares the gray_code_solver class, an exhaustive SAT search visiting assignments in Gray-code order.
+ *
+ * This header file defines the `gray_code_solver` class, which inherits from the `solver` abstract base class.
+ * It tries every assignment of the free variables, but consecutive assignments differ in exactly one variable, so
+ * each step updates only the clauses containing it. With no propagation, no pruning and no `state` objects, it
+ * runs at the speed of the hardware and is the baseline the generic solvers on `sat_state` are measured against.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef GRAY_CODE_SOLVER_H
+#define GRAY_CODE_SOLVER_H
+
+#pragma once
+
+#include "solver.h"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * @brief Exhaustive Gray-code search for `sat_state` problems.
+ *
+ * Only the free variables occurring in a clause are enumerated, the least frequent ones on the bits that flip most
+ * often, so the space has `2^n` assignments for `n` such variables, and the others are set to false. Step `i` flips
+ * the variable of the lowest set bit of `i`, which visits the assignment `i ^ (i >> 1)`, and updates the true-literal
+ * count of the clauses containing it, keeping the number of unsatisfied clauses. A range of the space starts by
+ * evaluating every clause at once with 64-bit masks of its positive and negative variables.
+ *
+ * The parallel version splits the space into contiguous ranges, which the OpenMP threads take dynamically, and stops
+ * every thread at the first model. The solver is complete: nullptr means the problem has no model (unless the search
+ * was stopped). Every assignment tried counts as one expanded state.
+ */
+class gray_code_solver : public solver {
+public:
+    /**
+     * @brief Maximum number of enumerated variables, the assignments are 64-bit masks.
+     */
+    static constexpr int MAX_VARIABLES = 62;
+
+    /**
+     * @brief Number of ranges generated per thread by the parallel version.
+     */
+    static constexpr unsigned int RANGES_PER_THREAD = 16;
+
+    /**
+     * @brief Number of steps between two checks of the stop flags.
+     */
+    static constexpr std::uint64_t CHECK_INTERVAL = 4096;
+
+    /**
+     * @brief Constructor for the gray_code_solver class.
+     *
+     * @param initial_state The initial state of the problem, must be a `sat_state`.
+     * @throws std::invalid_argument if the initial state is not a SAT state or has more than `MAX_VARIABLES` free
+     *                               variables occurring in a clause.
+     */
+    explicit gray_code_solver ( const state_pointer initial_state );
+
+    /**
+     * @brief Tries the assignments one after another.
+     *
+     * @return A state_pointer to a satisfying assignment, or nullptr if there is none.
+     */
+    state_pointer solve_seq () override;
+
+    /**
+     * @brief Tries the ranges of assignments on all OpenMP threads.
+     *
+     * @return A state_pointer to a satisfying assignment, or nullptr if there is none.
+     */
+    state_pointer solve_par () override;
+
+private:
+    /**
+     * @brief Searches the whole space.
+     *
+     * @param parallel If true, the ranges are searched on all OpenMP threads.
+     * @return A state_pointer to a satisfying assignment, or nullptr if there is none.
+     */
+    state_pointer search ( bool parallel );
+
+    /**
+     * @brief Tries the assignments of the steps `begin` to `end - 1`.
+     *
+     * @param begin The first step of the range.
+     * @param end The step after the last one.
+     * @param true_count Scratch space for the true-literal count of every clause.
+     * @param model Receives the assignment if one satisfies every clause.
+     * @return `true` if a model was found in the range.
+     */
+    bool search_range ( std::uint64_t begin, std::uint64_t end, std::vector<std::uint32_t> &true_count, std::uint64_t &model );
+
+    std::vector<int> variables; ///< The enumerated variables (identifier minus one), bit `i` of an assignment is `variables[i]`.
+    std::vector<std::uint64_t> positive; ///< The variables occurring positively in every clause, as a mask.
+    std::vector<std::uint64_t> negative; ///< The variables occurring negatively in every clause, as a mask.
+    std::vector<std::uint32_t> occurrence_starts; ///< Offset of the clauses of every literal `2 * bit + negated` in `occurrences`.
+    std::vector<std::uint32_t> occurrences; ///< The clauses containing each literal.
+    bool contradiction = false; ///< Set if the initial state falsifies a clause.
+
+    std::atomic<bool> found { false }; ///< Set by the first thread that finds a model.
+};
+
+#endif //GRAY_CODE_SOLVER_H
@@ -4,59 +4,65 @@
 
 #include "iddfs_solver.h"
 
-// Helper functions definitions
-void dfs_with_limit ( const state_pointer& root, unsigned int depth_limit, unsigned int current_depth, std::unordered_set<unsigned long long> visited );
-void dfs_with_limit_p ( const state_pointer& root, unsigned int depth_limit, unsigned int current_depth, std::unordered_set<unsigned long long>& visited );
-void dfs_with_limit_seq ( const state_pointer& root, unsigned int depth_limit, unsigned int current_depth, std::unordered_set<unsigned long long> visited );
-
-// Global vars
-state_pointer result = nullptr;
-state_pointer result_seq = nullptr;
-int task_threshold = 8;
-std::atomic<int> waiting_tasks = 0;
-std::atomic<unsigned long long> best_goal_identifier = ULLONG_MAX;
-
-
 state_pointer iddfs_solver::solve_seq () {
     unsigned int depth_limit = 0;
     std::unordered_set<unsigned long long> visited;
 
-    while ( result_seq == nullptr ) {
+    result = nullptr;
+    best_goal_identifier = ULLONG_MAX;
+    expanded_states = 0;
+    depth_cutoff = true;
+
+    // Stop once an iteration finishes without hitting the depth limit - the whole space was searched
+    while ( result == nullptr && depth_cutoff && !stop_requested ) {
         depth_limit++;
+        depth_cutoff = false;
         dfs_with_limit_seq( root, depth_limit, 0, visited );
     }
 
-    return result_seq;
+    return result;
 }
 
-void dfs_with_limit_seq ( const state_pointer& root, unsigned int depth_limit, unsigned int current_depth, std::unordered_set<unsigned long long> visited ) {
+void iddfs_solver::dfs_with_limit_seq ( const state_pointer& node, unsigned int depth_limit, unsigned int current_depth, std::unordered_set<unsigned long long> visited ) {
 
-    // Check for goal
-    if ( root->is_goal() && ( result_seq == nullptr || root->get_identifier() < result_seq->get_identifier() ) ) {
-        result_seq = root;
+    // Check for goal, the first goal ends the search
+    if ( node->is_goal() ) {
+        result = node;
         return;
     }
 
-    // Check depth limit
-    if ( current_depth >= depth_limit ) return;
-    visited.insert( root->get_identifier() );
+    // Check for cancellation and depth limit
+    if ( stop_requested ) return;
+    if ( current_depth >= depth_limit ) {
+        depth_cutoff = true;
+        return;
+    }
+    visited.insert( node->get_identifier() );
 
-    // Create tasks for children
-    for ( state_pointer child : root->get_descendents() ) {
+    // Explore children, the remaining ones are not even generated once a goal is found
+    ++expanded_states;
+    for ( const state_pointer &child : node->get_successors() ) {
         if ( visited.find( child->get_identifier() ) == visited.end() ) {
             dfs_with_limit_seq( child, depth_limit, current_depth + 1, visited );
         }
+        if ( result != nullptr || stop_requested ) break;
     }
 
-    visited.erase( root->get_identifier() );
+    visited.erase( node->get_identifier() );
 }
 
 
 state_pointer iddfs_solver::solve_par () {
     unsigned int depth_limit = 0;
 
-    while ( result == nullptr ) {
+    result = nullptr;
+    best_goal_identifier = ULLONG_MAX;
+    expanded_states = 0;
+    depth_cutoff = true;
+
+    while ( result == nullptr && depth_cutoff && !stop_requested ) {
         depth_limit++;
+        depth_cutoff = false;
         std::unordered_set<unsigned long long> visited;
 
         #pragma omp parallel
@@ -67,81 +73,86 @@ state_pointer iddfs_solver::solve_par () {
     return result;
 }
 
-void dfs_with_limit ( const state_pointer& root, unsigned int depth_limit, unsigned int current_depth, std::unordered_set<unsigned long long> visited ) {
+void iddfs_solver::record_goal ( const state_pointer& goal ) {
+    unsigned long long current_id = goal->get_identifier();
+    if ( current_id < best_goal_identifier ) {
+        #pragma omp critical
+        {
+            if ( current_id < best_goal_identifier ) {
+                best_goal_identifier = current_id;
+                result = goal;
+            }
+        }
+    }
+}
+
+void iddfs_solver::dfs_with_limit ( const state_pointer& node, unsigned int depth_limit, unsigned int current_depth, std::unordered_set<unsigned long long> visited ) {
     --waiting_tasks;
 
     // Check for goal
-    if ( root->is_goal() ) {
-        unsigned long long current_id = root->get_identifier();
-        if ( current_id < best_goal_identifier ) {
-            #pragma omp critical
-            {
-                if ( current_id < best_goal_identifier ) {
-                    best_goal_identifier = current_id;
-                    result = root;
-                }
-            }
-        }
+    if ( node->is_goal() ) {
+        record_goal( node );
         return;
     }
 
-    // Check depth limit
-    if ( current_depth >= depth_limit ) return;
+    // Check for cancellation, a goal found by another thread and depth limit
+    if ( stop_requested || best_goal_identifier != ULLONG_MAX ) return;
+    if ( current_depth >= depth_limit ) {
+        depth_cutoff = true;
+        return;
+    }
 
     bool should_continue;
     #pragma omp critical
-    should_continue = visited.insert(root->get_identifier()).second;
+    should_continue = visited.insert(node->get_identifier()).second;
 
     if ( !should_continue ) return;
 
     // Explore children
-    std::vector<state_pointer> children = root->get_descendents();
-    for ( size_t i = 0; i < children.size(); ++i ) {
+    ++expanded_states;
+    for ( state_pointer child : node->get_successors() ) {
+        if ( stop_requested || best_goal_identifier != ULLONG_MAX ) break;
         if ( static_cast<int>(current_depth) < task_threshold ) {
             #pragma omp task shared(visited)
-            dfs_with_limit(children[i], depth_limit, current_depth + 1, visited);
+            dfs_with_limit(child, depth_limit, current_depth + 1, visited);
         } else {
-            dfs_with_limit_p(children[i], depth_limit, current_depth + 1, visited);
+            dfs_with_limit_p(child, depth_limit, current_depth + 1, visited);
         }
     }
 
     #pragma omp taskwait
     #pragma omp critical
-    visited.erase(root->get_identifier());
+    visited.erase(node->get_identifier());
 }
 
-void dfs_with_limit_p ( const state_pointer& root, unsigned int depth_limit, unsigned int current_depth, std::unordered_set<unsigned long long>& visited ) {
+void iddfs_solver::dfs_with_limit_p ( const state_pointer& node, unsigned int depth_limit, unsigned int current_depth, std::unordered_set<unsigned long long>& visited ) {
 
     // Check for goal
-    if ( root->is_goal() ) {
-        unsigned long long current_id = root->get_identifier();
-        if ( current_id < best_goal_identifier ) {
-        #pragma omp critical
-            {
-                if ( current_id < best_goal_identifier ) {
-                    best_goal_identifier = current_id;
-                    result = root;
-                }
-            }
-        }
+    if ( node->is_goal() ) {
+        record_goal( node );
         return;
     }
 
-    // Check depth limit
-    if ( current_depth >= depth_limit ) return;
+    // Check for cancellation, a goal found by another thread and depth limit
+    if ( stop_requested || best_goal_identifier != ULLONG_MAX ) return;
+    if ( current_depth >= depth_limit ) {
+        depth_cutoff = true;
+        return;
+    }
 
     bool should_continue;
     #pragma omp critical
-    should_continue = visited.insert(root->get_identifier()).second;
+    should_continue = visited.insert(node->get_identifier()).second;
 
     if ( !should_continue ) return;
 
-    // Explore children
-    std::vector<state_pointer> children = root->get_descendents();
-    for ( size_t i = 0; i < children.size(); ++i ) {
-        dfs_with_limit_p(children[i], depth_limit, current_depth + 1, visited);
+    // Explore children, the remaining ones are not even generated once a goal is found
+    ++expanded_states;
+    for ( const state_pointer &child : node->get_successors() ) {
+        dfs_with_limit_p(child, depth_limit, current_depth + 1, visited);
+        if ( stop_requested || best_goal_identifier != ULLONG_MAX ) break;
     }
 
     #pragma omp critical
-    visited.erase(root->get_identifier());
+    visited.erase(node->get_identifier());
 }
@@ -26,7 +26,8 @@
  * @brief Implements the Iterative Deepening Depth-First Search (IDDFS) algorithm for solving state-space problems.
  *
  * This class provides both sequential (`solve_seq`) and parallel (`solve_par`) implementations of the IDDFS algorithm.
- * It inherits from the `solver` abstract base class.
+ * It inherits from the `solver` abstract base class. Children are taken from `state::get_successors` and an iteration
+ * ends at its first goal, so the children after a goal-reaching branch are never generated.
  */
 class iddfs_solver : public solver {
 public:
@@ -52,6 +53,50 @@ public:
      * @return A state_pointer to the solution state, or nullptr if no solution is found.
      */
     state_pointer solve_par () override;
+
+private:
+    /**
+     * @brief Depth-limited DFS used by the sequential solver.
+     *
+     * @param node The state to explore.
+     * @param depth_limit The maximum depth of the current iteration.
+     * @param current_depth The depth of `node`.
+     * @param visited The identifiers of the states on the current path.
+     */
+    void dfs_with_limit_seq ( const state_pointer& node, unsigned int depth_limit, unsigned int current_depth, std::unordered_set<unsigned long long> visited );
+
+    /**
+     * @brief Depth-limited DFS that spawns OpenMP tasks for the children of shallow states.
+     *
+     * @param node The state to explore.
+     * @param depth_limit The maximum depth of the current iteration.
+     * @param current_depth The depth of `node`.
+     * @param visited The identifiers of the states on the explored paths.
+     */
+    void dfs_with_limit ( const state_pointer& node, unsigned int depth_limit, unsigned int current_depth, std::unordered_set<unsigned long long> visited );
+
+    /**
+     * @brief Depth-limited DFS used by the parallel solver.
+     *
+     * @param node The state to explore.
+     * @param depth_limit The maximum depth of the current iteration.
+     * @param current_depth The depth of `node`.
+     * @param visited The identifiers of the states on the explored paths, shared between threads.
+     */
+    void dfs_with_limit_p ( const state_pointer& node, unsigned int depth_limit, unsigned int current_depth, std::unordered_set<unsigned long long>& visited );
+
+    /**
+     * @brief Records a goal state, keeping the one with the smallest identifier among those found before the threads stop.
+     *
+     * @param goal The goal state that was reached.
+     */
+    void record_goal ( const state_pointer& goal );
+
+    state_pointer result = nullptr; ///< The best goal state found by the current search.
+    std::atomic<unsigned long long> best_goal_identifier = ULLONG_MAX; ///< The identifier of `result`.
+    std::atomic<bool> depth_cutoff = false; ///< Set when the current iteration left states unexplored because of the depth limit.
+    std::atomic<int> waiting_tasks = 0; ///< The number of spawned tasks that did not start yet.
+    int task_threshold = 8; ///< Depth up to which `dfs_with_limit` spawns tasks.
 };
 
 #endif //IDDFS_SOLVER_H
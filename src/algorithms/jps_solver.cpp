@@ -0,0 +1,114 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "jps_solver.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <tuple>
+
+jps_solver::jps_solver ( const state_pointer initial_state ) : solver( initial_state ) {
+    const auto *maze = dynamic_cast<const maze_state*>(root.get());
+    if ( maze == nullptr ) throw std::invalid_argument("Jump point search needs a maze state.");
+    grid = maze->get_grid();
+    if ( std::any_of(grid->weights.begin(), grid->weights.end(), []( std::uint8_t weight ) { return weight != 1; }) ) {
+        throw std::invalid_argument("Jump point search needs unit step costs, use UCS on weighted mazes.");
+    }
+    jumps = maze_jump_table::get(grid);
+}
+
+state_pointer jps_solver::solve_seq () {
+    const int columns = grid->columns;
+    auto [start_row, start_column] = dynamic_cast<const maze_state&>(*root).get_position();
+    auto start = static_cast<std::uint32_t>(start_row * columns + start_column);
+
+    int goal_row = grid->goal_row, goal_column = grid->goal_column;
+    if ( goal_row < 0 ) {
+        auto goal = std::find(grid->cells.begin(), grid->cells.end(), maze_state::GOAL);
+        if ( goal == grid->cells.end() ) return nullptr;
+        goal_row = static_cast<int>(goal - grid->cells.begin()) / columns;
+        goal_column = static_cast<int>(goal - grid->cells.begin()) % columns;
+    }
+    auto goal = static_cast<std::uint32_t>(goal_row * columns + goal_column);
+
+    constexpr std::uint32_t NO_PARENT = std::numeric_limits<std::uint32_t>::max();
+    constexpr int NO_DIRECTION = -1;
+    const int row_steps[] = { 0, 0, -1, 1 };
+    const int column_steps[] = { -1, 1, 0, 0 };
+    const int reverse[] = { maze_jump_table::RIGHT, maze_jump_table::LEFT, maze_jump_table::DOWN, maze_jump_table::UP };
+
+    std::vector<unsigned int> costs(grid->cells.size(), std::numeric_limits<unsigned int>::max());
+    std::vector<std::uint32_t> parents(grid->cells.size(), NO_PARENT);
+    auto get_heuristic = [columns, goal_row, goal_column]( std::uint32_t cell ) {
+        return static_cast<unsigned int>(std::abs(static_cast<int>(cell) / columns - goal_row) + std::abs(static_cast<int>(cell) % columns - goal_column));
+    };
+
+    // (estimate, -cost, cell, direction of the move reaching it), deeper nodes first among equal estimates
+    using entry = std::tuple<unsigned int, long long, std::uint32_t, int>;
+    std::priority_queue<entry, std::vector<entry>, std::greater<>> open;
+    costs[start] = 0;
+    open.emplace(get_heuristic(start), 0, start, NO_DIRECTION);
+
+    bool found = start == goal;
+    while ( !open.empty() && !found && !stop_requested ) {
+        auto [estimate, negated_cost, cell, arrival] = open.top();
+        open.pop();
+        auto cost = static_cast<unsigned int>(-negated_cost);
+        if ( cost > costs[cell] ) continue;
+        if ( cell == goal ) {
+            found = true;
+            break;
+        }
+        ++expanded_states;
+
+        int row = static_cast<int>(cell) / columns, column = static_cast<int>(cell) % columns;
+        for ( int move = 0; move < 4; ++move ) {
+            if ( arrival != NO_DIRECTION && move == reverse[arrival] ) continue;
+
+            int jump = jumps->get_jump(cell, static_cast<maze_jump_table::direction>(move));
+            int reach = std::abs(jump);
+            int distance = jump > 0 ? jump : 0;
+
+            // The goal (horizontally) or its row (vertically) interrupts the jump if the move gets there first
+            int goal_distance = row_steps[move] == 0
+                                ? ( goal_row == row ? ( goal_column - column ) * column_steps[move] : 0 )
+                                : ( goal_row - row ) * row_steps[move];
+            if ( goal_distance > 0 && goal_distance <= reach ) distance = goal_distance;
+            if ( distance == 0 ) continue;
+
+            auto next = static_cast<std::uint32_t>(( row + row_steps[move] * distance ) * columns + column + column_steps[move] * distance);
+            unsigned int next_cost = cost + static_cast<unsigned int>(distance);
+            if ( next_cost < costs[next] ) {
+                costs[next] = next_cost;
+                parents[next] = cell;
+                open.emplace(next_cost + get_heuristic(next), -static_cast<long long>(next_cost), next, move);
+            }
+        }
+    }
+    if ( !found ) return nullptr;
+
+    // Fill in the cells between the jump points
+    std::vector<std::uint32_t> jump_points;
+    for ( std::uint32_t cell = goal; cell != start; cell = parents[cell] ) jump_points.push_back(cell);
+    state_pointer path = root;
+    std::uint32_t previous = start;
+    for ( auto it = jump_points.rbegin(); it != jump_points.rend(); ++it ) {
+        int row = static_cast<int>(previous) / columns, column = static_cast<int>(previous) % columns;
+        int target_row = static_cast<int>(*it) / columns, target_column = static_cast<int>(*it) % columns;
+        while ( row != target_row || column != target_column ) {
+            row += ( target_row > row ) - ( target_row < row );
+            column += ( target_column > column ) - ( target_column < column );
+            path = std::make_shared<const maze_state>(path, grid, std::make_pair(row, column));
+        }
+        previous = *it;
+    }
+    return path;
+}
+
+state_pointer jps_solver::solve_par () {
+    return solve_seq();
+}
@@ -0,0 +1,65 @@
+/**
+ * @file jps_solver.h
+ * @brief Declares the jps_solver class, which runs jump point search with precomputed jumps (JPS+) on mazes.
+ *
+ * This header file defines the `jps_solver` class, which inherits from the `solver` abstract base class. On grids
+ * many shortest paths are symmetric (the same moves in a different order), and BFS or A* expand every cell of all of
+ * them. Jump point search only stops at cells where an optimal path may have to turn, and the `maze_jump_table`
+ * gives the distance to the next such cell in one lookup, so straight runs of any length cost a single step.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef JPS_SOLVER_H
+#define JPS_SOLVER_H
+
+#pragma once
+
+#include "solver.h"
+#include "../generators/maze_generator.h"
+#include "../preprocessing/maze_jump_table.h"
+
+
+/**
+ * @brief Jump point search (4-connected JPS+) for `maze_state` problems with unit step costs.
+ *
+ * A* with the Manhattan distance runs over jump points. A node reached by a move continues in the three directions
+ * other than back, the start in all four, and each direction jumps to the point from the table. A horizontal jump
+ * stops at the goal if it lies on its way, a vertical one at the row of the goal, from where a horizontal jump can
+ * reach it. The path between the jump points is filled in with `maze_state`s, so its length equals the BFS path
+ * length, while every expanded jump point counts as one expanded state.
+ *
+ * The search is sequential, `solve_par` runs the same search. Weighted mazes are rejected, their cheapest paths are
+ * not straight-line symmetric and need UCS.
+ */
+class jps_solver : public solver {
+public:
+    /**
+     * @brief Constructor for the jps_solver class.
+     *
+     * @param initial_state The initial state of the problem, must be a `maze_state`.
+     * @throws std::invalid_argument if the initial state is not a maze state or the maze has cell weights other than 1.
+     */
+    explicit jps_solver ( const state_pointer initial_state );
+
+    /**
+     * @brief Runs jump point search.
+     *
+     * @return A state_pointer to the goal state, or nullptr if the goal cannot be reached.
+     */
+    state_pointer solve_seq () override;
+
+    /**
+     * @brief Runs the sequential jump point search.
+     *
+     * @return A state_pointer to the goal state, or nullptr if the goal cannot be reached.
+     */
+    state_pointer solve_par () override;
+
+private:
+    std::shared_ptr<const maze_state::grid_layout> grid; ///< The maze.
+    std::shared_ptr<const maze_jump_table> jumps; ///< The jumps of the maze.
+};
+
+#endif //JPS_SOLVER_H
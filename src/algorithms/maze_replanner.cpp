@@ -0,0 +1,185 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "maze_replanner.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    constexpr unsigned long long INFINITE_COST = state::UNREACHABLE;
+
+    unsigned long long add_costs ( unsigned long long first, unsigned long long second ) {
+        return first == INFINITE_COST || second == INFINITE_COST ? INFINITE_COST : first + second;
+    }
+}
+
+maze_replanner::maze_replanner ( std::shared_ptr<const maze_state::grid_layout> grid, std::pair<int, int> start )
+        : grid( std::make_shared<maze_state::grid_layout>(*grid) ) {
+    if ( std::find(this->grid->weights.begin(), this->grid->weights.end(), 0) != this->grid->weights.end() ) {
+        throw std::invalid_argument("The replanner needs cell weights of at least 1.");
+    }
+    this->start = last_start = get_cell(start);
+
+    std::size_t num_cells = this->grid->cells.size();
+    costs.assign(num_cells, INFINITE_COST);
+    supported_costs.assign(num_cells, INFINITE_COST);
+    queued_keys.assign(num_cells, { INFINITE_COST, INFINITE_COST });
+    queued.assign(num_cells, 0);
+
+    // The search grows from all goals at once
+    for ( std::size_t cell = 0; cell < num_cells; ++cell ) {
+        if ( this->grid->cells[cell] == maze_state::GOAL ) update_cell(static_cast<std::uint32_t>(cell));
+    }
+}
+
+void maze_replanner::set_cell ( std::pair<int, int> position, maze_state::cell_type type, std::uint8_t weight ) {
+    std::uint32_t cell = get_cell(position);
+    if ( weight == 0 ) throw std::invalid_argument("The replanner needs cell weights of at least 1.");
+    if ( grid->cells[cell] == type && get_entry_cost(cell) == ( type == maze_state::WALL ? INFINITE_COST : weight ) ) return;
+
+    // Paths returned earlier keep the maze they were found in
+    if ( grid.use_count() > 1 ) grid = std::make_shared<maze_state::grid_layout>(*grid);
+    if ( type == maze_state::GOAL || ( position.first == grid->goal_row && position.second == grid->goal_column ) ) {
+        grid->goal_row = grid->goal_column = -1;
+    }
+    if ( grid->weights.empty() && weight != 1 ) grid->weights.assign(grid->cells.size(), 1);
+    grid->cells[cell] = type;
+    if ( !grid->weights.empty() ) grid->weights[cell] = weight;
+
+    // Only the moves into the cell and out of it changed
+    update_cell(cell);
+    grid->for_each_neighbour(cell, [this]( std::uint32_t neighbour ) { update_cell(neighbour); });
+}
+
+void maze_replanner::set_start ( std::pair<int, int> position ) {
+    start = get_cell(position);
+    key_offset += get_heuristic(last_start, start);
+    last_start = start;
+}
+
+unsigned long long maze_replanner::get_cost () {
+    if ( grid->cells[start] == maze_state::WALL ) return INFINITE_COST;
+    compute_shortest_path();
+    return costs[start];
+}
+
+state_pointer maze_replanner::find_path () {
+    if ( get_cost() == INFINITE_COST ) return nullptr;
+
+    // Following the cheapest neighbour by its cost to the goal walks a cheapest path
+    const int columns = grid->columns;
+    std::uint32_t cell = start;
+    state_pointer path = std::make_shared<const maze_state>(nullptr, grid, std::make_pair(static_cast<int>(cell) / columns, static_cast<int>(cell) % columns));
+    while ( grid->cells[cell] != maze_state::GOAL ) {
+        std::uint32_t next = cell;
+        unsigned long long next_cost = INFINITE_COST;
+        grid->for_each_neighbour(cell, [this, &next, &next_cost]( std::uint32_t neighbour ) {
+            unsigned long long cost = add_costs(get_entry_cost(neighbour), costs[neighbour]);
+            if ( cost < next_cost ) {
+                next = neighbour;
+                next_cost = cost;
+            }
+        });
+        if ( next_cost == INFINITE_COST ) return nullptr;
+
+        cell = next;
+        path = std::make_shared<const maze_state>(path, grid, std::make_pair(static_cast<int>(cell) / columns, static_cast<int>(cell) % columns));
+    }
+    return path;
+}
+
+std::shared_ptr<const maze_state::grid_layout> maze_replanner::get_grid () const {
+    return grid;
+}
+
+unsigned long long maze_replanner::get_expanded_states () const {
+    return expanded_states;
+}
+
+maze_replanner::key maze_replanner::calculate_key ( std::uint32_t cell ) const {
+    unsigned long long cost = std::min(costs[cell], supported_costs[cell]);
+    if ( cost == INFINITE_COST ) return { INFINITE_COST, INFINITE_COST };
+    return { cost + get_heuristic(start, cell) + key_offset, cost };
+}
+
+void maze_replanner::update_cell ( std::uint32_t cell ) {
+    if ( grid->cells[cell] == maze_state::GOAL ) {
+        supported_costs[cell] = 0;
+    } else if ( grid->cells[cell] == maze_state::WALL ) {
+        supported_costs[cell] = INFINITE_COST;
+    } else {
+        unsigned long long cost = INFINITE_COST;
+        grid->for_each_neighbour(cell, [this, &cost]( std::uint32_t neighbour ) {
+            cost = std::min(cost, add_costs(get_entry_cost(neighbour), costs[neighbour]));
+        });
+        supported_costs[cell] = cost;
+    }
+
+    if ( costs[cell] == supported_costs[cell] ) {
+        queued[cell] = 0;
+        return;
+    }
+    key cell_key = calculate_key(cell);
+    if ( queued[cell] && queued_keys[cell] == cell_key ) return;
+    queued[cell] = 1;
+    queued_keys[cell] = cell_key;
+    queue.emplace(cell_key.first, cell_key.second, cell);
+}
+
+void maze_replanner::compute_shortest_path () {
+    expanded_states = 0;
+    for ( drop_stale_entries(); !queue.empty(); drop_stale_entries() ) {
+        auto [first, second, cell] = queue.top();
+        key top_key { first, second };
+        if ( top_key >= calculate_key(start) && costs[start] == supported_costs[start] ) break;
+        ++expanded_states;
+
+        // A key computed before the start moved is too small, the cell goes back with its current key
+        key cell_key = calculate_key(cell);
+        queue.pop();
+        if ( top_key < cell_key ) {
+            queued_keys[cell] = cell_key;
+            queue.emplace(cell_key.first, cell_key.second, cell);
+            continue;
+        }
+        queued[cell] = 0;
+
+        if ( costs[cell] > supported_costs[cell] ) {
+            costs[cell] = supported_costs[cell];
+        } else {
+            costs[cell] = INFINITE_COST;
+            update_cell(cell);
+        }
+        grid->for_each_neighbour(cell, [this]( std::uint32_t neighbour ) { update_cell(neighbour); });
+    }
+}
+
+void maze_replanner::drop_stale_entries () {
+    while ( !queue.empty() ) {
+        auto [first, second, cell] = queue.top();
+        if ( queued[cell] && queued_keys[cell] == key { first, second } ) return;
+        queue.pop();
+    }
+}
+
+std::uint32_t maze_replanner::get_cell ( std::pair<int, int> position ) const {
+    auto [row, column] = position;
+    if ( row < 0 || row >= grid->rows || column < 0 || column >= grid->columns ) {
+        throw std::invalid_argument("Position (" + std::to_string(row) + ", " + std::to_string(column) + ") is outside the maze.");
+    }
+    return static_cast<std::uint32_t>(row * grid->columns + column);
+}
+
+unsigned long long maze_replanner::get_heuristic ( std::uint32_t from, std::uint32_t to ) const {
+    const int columns = grid->columns;
+    return static_cast<unsigned long long>(std::abs(static_cast<int>(from) / columns - static_cast<int>(to) / columns)
+                                           + std::abs(static_cast<int>(from) % columns - static_cast<int>(to) % columns));
+}
+
+unsigned long long maze_replanner::get_entry_cost ( std::uint32_t cell ) const {
+    return grid->cells[cell] == maze_state::WALL ? INFINITE_COST : grid->get_weight(cell);
+}
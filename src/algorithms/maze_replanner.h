@@ -0,0 +1,153 @@
+/**
+ * @file maze_replanner.h
+ * @brief Declares the maze_replanner class, an incremental D* Lite planner for mazes whose cells change between queries.
+ *
+ * This header file defines the `maze_replanner` class. A fresh search after every edit of a maze repeats all the work
+ * of the previous one. The replanner keeps its search state (the `g` and `rhs` values of every cell and the priority
+ * queue of the inconsistent cells) between queries, so after a wall is added or removed, or the start moves, only the
+ * cells whose cost to the goal changed are searched again.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef MAZE_REPLANNER_H
+#define MAZE_REPLANNER_H
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../generators/maze_generator.h"
+
+
+/**
+ * @brief D* Lite (Koenig and Likhachev) on a maze grid with cell weights.
+ *
+ * The search runs backward: `g` of a cell is the cost of its cheapest path to any goal cell, and `rhs` is the value
+ * its neighbours currently support (zero on goals). Cells where the two differ wait in a queue ordered by
+ * `min(g, rhs) + h` with the Manhattan distance `h` from the start, so a query stops as soon as the start is
+ * consistent and nothing cheaper can change it. An edit only makes the edited cell and its four neighbours
+ * inconsistent, and moving the start raises the key offset `km` instead of reordering the queue.
+ *
+ * The replanner owns a copy of the grid and shares it with the paths it returns, an edit copies it again only while
+ * such a path is still alive. Entering a cell costs its weight, like `maze_state::get_step_cost`, and weights must be
+ * at least 1 for the heuristic to stay admissible. The replanner is not thread-safe.
+ */
+class maze_replanner {
+public:
+    /**
+     * @brief Constructor for the maze_replanner class, nothing is searched before the first query.
+     *
+     * @param grid The maze grid, the replanner edits its own copy.
+     * @param start The (row, column) position of the start.
+     * @throws std::invalid_argument if the start is outside the maze or a cell weight is 0.
+     */
+    maze_replanner ( std::shared_ptr<const maze_state::grid_layout> grid, std::pair<int, int> start );
+
+    /**
+     * @brief Changes a cell of the maze, the next query repairs the costs it affects.
+     *
+     * @param position The (row, column) position of the cell.
+     * @param type The new type of the cell.
+     * @param weight The new cost of entering the cell.
+     * @throws std::invalid_argument if the position is outside the maze or the weight is 0.
+     */
+    void set_cell ( std::pair<int, int> position, maze_state::cell_type type, std::uint8_t weight = 1 );
+
+    /**
+     * @brief Moves the start, for example to the next cell of the previous path.
+     *
+     * @param position The (row, column) position of the new start.
+     * @throws std::invalid_argument if the position is outside the maze.
+     */
+    void set_start ( std::pair<int, int> position );
+
+    /**
+     * @brief Returns the cost of the cheapest path from the start to a goal, replanning if needed.
+     *
+     * @return The sum of the weights of the cells entered, or `state::UNREACHABLE` if there is no path.
+     */
+    [[nodiscard]] unsigned long long get_cost ();
+
+    /**
+     * @brief Finds the cheapest path from the start to a goal, replanning if needed.
+     *
+     * @return The `maze_state` of the goal, its predecessors walk every cell back to the start (whose predecessor is
+     *         null), or nullptr if there is no path. The states share the current grid.
+     */
+    [[nodiscard]] state_pointer find_path ();
+
+    /**
+     * @brief Returns the current maze, including all edits.
+     */
+    [[nodiscard]] std::shared_ptr<const maze_state::grid_layout> get_grid () const;
+
+    /**
+     * @brief Returns the number of cells taken from the queue by the last replanning.
+     */
+    [[nodiscard]] unsigned long long get_expanded_states () const;
+
+private:
+    /**
+     * @brief The priority of a cell in the queue, compared lexicographically.
+     */
+    using key = std::pair<unsigned long long, unsigned long long>;
+
+    /**
+     * @brief Computes the priority of a cell from its current values.
+     */
+    [[nodiscard]] key calculate_key ( std::uint32_t cell ) const;
+
+    /**
+     * @brief Recomputes `rhs` of a cell from its neighbours and queues the cell if it is inconsistent.
+     */
+    void update_cell ( std::uint32_t cell );
+
+    /**
+     * @brief Searches until the start is consistent and no queued cell can lower its cost.
+     */
+    void compute_shortest_path ();
+
+    /**
+     * @brief Drops the queue entries of cells that were removed or queued again with a new key.
+     */
+    void drop_stale_entries ();
+
+    /**
+     * @brief Returns the cell of a position.
+     *
+     * @throws std::invalid_argument if the position is outside the maze.
+     */
+    [[nodiscard]] std::uint32_t get_cell ( std::pair<int, int> position ) const;
+
+    /**
+     * @brief Returns the Manhattan distance between two cells.
+     */
+    [[nodiscard]] unsigned long long get_heuristic ( std::uint32_t from, std::uint32_t to ) const;
+
+    /**
+     * @brief Returns the cost of entering a cell, `state::UNREACHABLE` for walls.
+     */
+    [[nodiscard]] unsigned long long get_entry_cost ( std::uint32_t cell ) const;
+
+    std::shared_ptr<maze_state::grid_layout> grid; ///< The current maze, copied before an edit while returned paths share it.
+    std::uint32_t start; ///< The cell of the start.
+    std::uint32_t last_start; ///< The start the key offset was last updated for.
+    unsigned long long key_offset = 0; ///< The `km` of D* Lite, the heuristic distance the start has moved.
+    std::vector<unsigned long long> costs; ///< The `g` value of every cell.
+    std::vector<unsigned long long> supported_costs; ///< The `rhs` value of every cell.
+    std::vector<key> queued_keys; ///< The key of every queued cell.
+    std::vector<char> queued; ///< Whether a cell is in the queue.
+    std::priority_queue<std::tuple<unsigned long long, unsigned long long, std::uint32_t>,
+                        std::vector<std::tuple<unsigned long long, unsigned long long, std::uint32_t>>, std::greater<>> queue; ///< The inconsistent cells, with stale entries.
+    unsigned long long expanded_states = 0; ///< The cells taken from the queue by the last replanning.
+};
+
+#endif //MAZE_REPLANNER_H
@@ -0,0 +1,439 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "model_counter.h"
+#include "../generators/sat_generator.h"
+#include "../preprocessing/sat_preprocessor.h"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <omp.h>
+
+namespace {
+    /**
+     * @brief Size of the per-thread buffer of enumerated models written in one block.
+     */
+    constexpr std::size_t OUTPUT_BLOCK = 1 << 20;
+}
+
+model_count &model_count::add_power_of_two ( std::size_t exponent ) {
+    std::size_t limb = exponent / 32;
+    if ( limbs.size() <= limb ) limbs.resize(limb + 1, 0);
+    std::uint64_t carry = std::uint64_t(1) << ( exponent % 32 );
+    for ( std::size_t i = limb; carry != 0; ++i ) {
+        if ( i == limbs.size() ) limbs.push_back(0);
+        std::uint64_t sum = limbs[i] + carry;
+        limbs[i] = static_cast<std::uint32_t>(sum);
+        carry = sum >> 32;
+    }
+    return *this;
+}
+
+model_count &model_count::operator+= ( const model_count &other ) {
+    if ( limbs.size() < other.limbs.size() ) limbs.resize(other.limbs.size(), 0);
+    std::uint64_t carry = 0;
+    for ( std::size_t i = 0; i < limbs.size(); ++i ) {
+        std::uint64_t sum = limbs[i] + carry + ( i < other.limbs.size() ? other.limbs[i] : 0 );
+        limbs[i] = static_cast<std::uint32_t>(sum);
+        carry = sum >> 32;
+    }
+    if ( carry != 0 ) limbs.push_back(static_cast<std::uint32_t>(carry));
+    return *this;
+}
+
+bool model_count::operator== ( const model_count &other ) const {
+    model_count left = *this, right = other;
+    left.trim();
+    right.trim();
+    return left.limbs == right.limbs;
+}
+
+bool model_count::is_zero () const {
+    return std::all_of(limbs.begin(), limbs.end(), []( std::uint32_t limb ) { return limb == 0; });
+}
+
+std::string model_count::to_string () const {
+    // Divide by 10^9 repeatedly, the remainders are the groups of nine decimal digits
+    std::vector<std::uint32_t> quotient = limbs;
+    std::vector<std::uint32_t> groups;
+    while ( !quotient.empty() && quotient.back() == 0 ) quotient.pop_back();
+    while ( !quotient.empty() ) {
+        std::uint64_t remainder = 0;
+        for ( std::size_t i = quotient.size(); i-- > 0; ) {
+            std::uint64_t value = ( remainder << 32 ) | quotient[i];
+            quotient[i] = static_cast<std::uint32_t>(value / 1000000000);
+            remainder = value % 1000000000;
+        }
+        groups.push_back(static_cast<std::uint32_t>(remainder));
+        while ( !quotient.empty() && quotient.back() == 0 ) quotient.pop_back();
+    }
+    if ( groups.empty() ) return "0";
+
+    std::string result = std::to_string(groups.back());
+    for ( std::size_t i = groups.size() - 1; i-- > 0; ) {
+        std::string group = std::to_string(groups[i]);
+        result += std::string(9 - group.size(), '0') + group;
+    }
+    return result;
+}
+
+void model_count::trim () {
+    while ( !limbs.empty() && limbs.back() == 0 ) limbs.pop_back();
+}
+
+
+class model_counter::engine {
+public:
+    /**
+     * @brief Copies the clause counters and propagates the unit clauses.
+     *
+     * @param owner The counter holding the clauses.
+     * @param output The stream receiving the enumerated models, nullptr to only count them.
+     * @param output_mutex Serializes the blocks written by the engines.
+     */
+    engine ( model_counter &owner, std::ostream *output, std::mutex &output_mutex )
+        : owner( owner ), output( output ), output_mutex( output_mutex ), values( owner.initial_values ),
+          true_count( owner.clause_starts.size() - 1, 0 ), false_count( owner.clause_starts.size() - 1, 0 ) {
+        for ( std::int8_t value : values ) num_unassigned += value < 0 ? 1 : 0;
+        for ( std::uint32_t clause = 0; clause < true_count.size(); ++clause ) {
+            if ( get_size(clause) == 1 ) pending.push_back(clause);
+        }
+        consistent = !owner.contradiction && propagate();
+    }
+
+    /**
+     * @brief Writes the buffered models and publishes the expanded nodes.
+     */
+    ~engine () {
+        flush();
+        owner.expanded_states += expansions;
+    }
+
+    /**
+     * @brief Returns false if the unit clauses of the problem already conflict.
+     */
+    [[nodiscard]] bool is_consistent () const {
+        return consistent;
+    }
+
+    /**
+     * @brief Returns the models counted by this engine.
+     */
+    [[nodiscard]] const model_count &get_count () const {
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of assigned literals, the mark `undo` returns to.
+     */
+    [[nodiscard]] std::size_t get_mark () const {
+        return trail.size();
+    }
+
+    /**
+     * @brief Makes a literal true and propagates it.
+     *
+     * @return `false` if propagation found a conflict, the caller still has to undo to its mark.
+     */
+    bool assume ( int literal ) {
+        if ( get_value(literal) >= 0 ) return get_value(literal) == 1;
+        if ( assign(literal) && propagate() ) return true;
+        pending.clear();
+        return false;
+    }
+
+    /**
+     * @brief Unassigns the literals assigned after a mark.
+     */
+    void undo ( std::size_t mark ) {
+        while ( trail.size() > mark ) {
+            int literal = trail.back();
+            trail.pop_back();
+            for ( std::uint32_t clause : owner.occurrences[literal] ) {
+                if ( --true_count[clause] == 0 ) --num_satisfied;
+            }
+            for ( std::uint32_t clause : owner.occurrences[literal ^ 1] ) --false_count[clause];
+            values[literal >> 1] = -1;
+            ++num_unassigned;
+        }
+    }
+
+    /**
+     * @brief Counts the models below the current assignment.
+     *
+     * @param first A clause such that every clause before it is satisfied.
+     */
+    void search ( std::uint32_t first ) {
+        if ( owner.stop_requested ) return;
+        ++expansions;
+        if ( is_satisfied() ) {
+            credit();
+            return;
+        }
+
+        int literal = get_branch_literal(first);
+        for ( int branch : { literal, literal ^ 1 } ) {
+            std::size_t mark = get_mark();
+            if ( assume(branch) ) search(first);
+            undo(mark);
+        }
+    }
+
+    /**
+     * @brief Collects the subtrees below the current assignment, counting the satisfied ones on the way.
+     *
+     * @param depth The remaining depth of the split.
+     * @param cube The literals decided on the way to the node.
+     * @param cubes Receives the decisions of every subtree.
+     */
+    void split ( unsigned int depth, std::vector<int> &cube, std::vector<std::vector<int>> &cubes ) {
+        if ( is_satisfied() ) {
+            ++expansions;
+            credit();
+            return;
+        }
+        if ( depth == 0 ) {
+            cubes.push_back(cube);
+            return;
+        }
+
+        ++expansions;
+        std::uint32_t first = 0;
+        int literal = get_branch_literal(first);
+        for ( int branch : { literal, literal ^ 1 } ) {
+            std::size_t mark = get_mark();
+            cube.push_back(branch);
+            if ( assume(branch) ) split(depth - 1, cube, cubes);
+            cube.pop_back();
+            undo(mark);
+        }
+    }
+
+private:
+    /**
+     * @brief Returns 1 if the literal is true, 0 if it is false and -1 if its variable is unassigned.
+     */
+    [[nodiscard]] int get_value ( int literal ) const {
+        int value = values[literal >> 1];
+        return value < 0 ? -1 : value ^ ( literal & 1 );
+    }
+
+    /**
+     * @brief Returns the number of literals of a clause.
+     */
+    [[nodiscard]] std::uint32_t get_size ( std::uint32_t clause ) const {
+        return owner.clause_starts[clause + 1] - owner.clause_starts[clause];
+    }
+
+    /**
+     * @brief Checks whether every clause has a true literal.
+     */
+    [[nodiscard]] bool is_satisfied () const {
+        return num_satisfied == true_count.size();
+    }
+
+    /**
+     * @brief Returns an unassigned literal of the first unsatisfied clause at or after `first`.
+     *
+     * After propagation an unsatisfied clause has at least two unassigned literals, so one always exists.
+     */
+    int get_branch_literal ( std::uint32_t &first ) const {
+        while ( true_count[first] > 0 ) ++first;
+        for ( std::uint32_t i = owner.clause_starts[first]; i < owner.clause_starts[first + 1]; ++i ) {
+            if ( get_value(owner.literals[i]) < 0 ) return owner.literals[i];
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Makes a literal true and updates the counters of its clauses, queueing the clauses it makes unit.
+     *
+     * @return `false` if a clause became false.
+     */
+    bool assign ( int literal ) {
+        values[literal >> 1] = static_cast<std::int8_t>(( literal & 1 ) ^ 1);
+        trail.push_back(literal);
+        --num_unassigned;
+
+        // Every counter is updated even after a conflict, so undo restores them exactly
+        bool result = true;
+        for ( std::uint32_t clause : owner.occurrences[literal] ) {
+            if ( true_count[clause]++ == 0 ) ++num_satisfied;
+        }
+        for ( std::uint32_t clause : owner.occurrences[literal ^ 1] ) {
+            std::uint32_t falsified = ++false_count[clause];
+            if ( true_count[clause] > 0 ) continue;
+            if ( falsified == get_size(clause) ) result = false;
+            else if ( falsified + 1 == get_size(clause) ) pending.push_back(clause);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Assigns the last literal of every queued unit clause.
+     *
+     * @return `false` if a clause became false.
+     */
+    bool propagate () {
+        while ( !pending.empty() ) {
+            std::uint32_t clause = pending.back();
+            pending.pop_back();
+            if ( true_count[clause] > 0 ) continue;
+
+            int unit = -1;
+            for ( std::uint32_t i = owner.clause_starts[clause]; i < owner.clause_starts[clause + 1] && unit < 0; ++i ) {
+                if ( get_value(owner.literals[i]) < 0 ) unit = owner.literals[i];
+            }
+            if ( unit < 0 || !assign(unit) ) {
+                pending.clear();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Credits the `2^k` models of a satisfied node and writes them if enumerating.
+     */
+    void credit () {
+        count.add_power_of_two(num_unassigned);
+        if ( output == nullptr ) return;
+        if ( num_unassigned >= 64 ) throw std::invalid_argument("Cannot enumerate 2^" + std::to_string(num_unassigned) + " models of one subtree.");
+
+        std::vector<int> free_variables;
+        for ( int variable = 0; variable < owner.num_variables; ++variable ) {
+            if ( values[variable] < 0 ) free_variables.push_back(variable);
+        }
+
+        // The free variables take every combination, the others keep their value
+        char number[16];
+        std::uint64_t combinations = std::uint64_t(1) << free_variables.size();
+        for ( std::uint64_t combination = 0; combination < combinations; ++combination ) {
+            for ( std::size_t i = 0; i < free_variables.size(); ++i ) {
+                values[free_variables[i]] = static_cast<std::int8_t>(( combination >> i ) & 1);
+            }
+            for ( int variable = 0; variable < owner.num_variables; ++variable ) {
+                if ( values[variable] == 0 ) buffer += '-';
+                buffer.append(number, std::to_chars(number, number + sizeof(number), variable + 1).ptr);
+                buffer += ' ';
+            }
+            buffer += "0\n";
+            if ( buffer.size() >= OUTPUT_BLOCK ) flush();
+        }
+        for ( int variable : free_variables ) values[variable] = -1;
+    }
+
+    /**
+     * @brief Writes the buffered models.
+     */
+    void flush () {
+        if ( output == nullptr || buffer.empty() ) return;
+        std::lock_guard<std::mutex> lock(output_mutex);
+        output->write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+
+    model_counter &owner; ///< The counter holding the clauses.
+    std::ostream *output; ///< The stream receiving the enumerated models, nullptr to only count them.
+    std::mutex &output_mutex; ///< Serializes the blocks written by the engines.
+    std::string buffer; ///< The enumerated models not written yet.
+
+    std::vector<std::int8_t> values; ///< The value of every variable, -1 if unassigned.
+    std::vector<std::uint32_t> true_count; ///< The number of true literals of every clause.
+    std::vector<std::uint32_t> false_count; ///< The number of false literals of every clause.
+    std::size_t num_satisfied = 0; ///< The number of clauses with a true literal.
+    std::size_t num_unassigned = 0; ///< The number of unassigned variables.
+    std::vector<int> trail; ///< The assigned literals, in order.
+    std::vector<std::uint32_t> pending; ///< The clauses that became unit and are not propagated yet.
+    bool consistent = true; ///< Cleared if the unit clauses of the problem conflict.
+
+    model_count count; ///< The models counted by this engine.
+    unsigned long long expansions = 0; ///< The nodes explored by this engine.
+};
+
+
+model_counter::model_counter ( const state_pointer &initial_state ) {
+    const auto *sat = dynamic_cast<const sat_state*>(initial_state.get());
+    if ( sat == nullptr ) throw std::invalid_argument("Model counting needs a SAT problem.");
+    if ( sat->is_preprocessed() ) throw std::invalid_argument("Model counting needs the original SAT problem, preprocessing keeps satisfiability but drops models.");
+
+    const sat_problem &problem = sat->get_problem();
+    std::map<int, bool> assignment = sat->get_assignment();
+    num_variables = problem.num_variables;
+    initial_values.assign(num_variables, -1);
+    for ( const auto &[variable, value] : assignment ) initial_values[variable - 1] = value ? 1 : 0;
+    occurrences.resize(2 * static_cast<std::size_t>(num_variables));
+
+    // Only the clauses left by the initial assignment are searched
+    sat_flat_clauses flat = sat_preprocessor::flatten(problem, assignment);
+    clause_starts = std::move(flat.clause_starts);
+    literals = std::move(flat.literals);
+    contradiction = flat.contradiction;
+    for ( std::uint32_t clause = 0; clause + 1 < clause_starts.size(); ++clause ) {
+        for ( std::uint32_t i = clause_starts[clause]; i < clause_starts[clause + 1]; ++i ) occurrences[literals[i]].push_back(clause);
+    }
+}
+
+model_count model_counter::count ( bool parallel ) {
+    return run(nullptr, parallel);
+}
+
+model_count model_counter::enumerate ( std::ostream &output, bool parallel ) {
+    return run(&output, parallel);
+}
+
+model_count model_counter::run ( std::ostream *output, bool parallel ) {
+    stop_requested = false;
+    expanded_states = 0;
+
+    std::mutex output_mutex;
+    model_count total;
+    std::vector<std::vector<int>> cubes;
+    {
+        engine master(*this, output, output_mutex);
+        if ( !master.is_consistent() ) return total;
+
+        if ( !parallel ) {
+            master.search(0);
+            return master.get_count();
+        }
+
+        // Split the top of the tree, the satisfied nodes above the split are counted right away
+        auto subtrees = static_cast<unsigned int>(omp_get_max_threads()) * SUBTREES_PER_THREAD;
+        std::vector<int> cube;
+        master.split(static_cast<unsigned int>(std::bit_width(subtrees - 1)), cube, cubes);
+        total = master.get_count();
+    }
+
+    std::exception_ptr error = nullptr;
+    #pragma omp parallel
+    {
+        engine worker(*this, output, output_mutex);
+
+        #pragma omp for schedule(dynamic, 1)
+        for ( std::size_t i = 0; i < cubes.size(); ++i ) {
+            std::size_t mark = worker.get_mark();
+            try {
+                bool consistent = true;
+                for ( int literal : cubes[i] ) consistent = consistent && worker.assume(literal);
+                if ( consistent ) worker.search(0);
+            } catch ( ... ) {
+                stop_requested = true;
+                #pragma omp critical
+                if ( error == nullptr ) error = std::current_exception();
+            }
+            worker.undo(mark);
+        }
+
+        #pragma omp critical
+        total += worker.get_count();
+    }
+
+    if ( error ) std::rethrow_exception(error);
+    return total;
+}
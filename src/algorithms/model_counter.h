@@ -0,0 +1,155 @@
+/**
+ * @file model_counter.h
+ * @brief Declares the model_counter class, which counts or enumerates all models of a SAT problem.
+ *
+ * This header file defines the `model_count` class, an unbounded unsigned integer for model counts, and the
+ * `model_counter` class. Instead of stopping at the first goal, the counter explores the whole DPLL tree of a
+ * `sat_state` problem, and every subtree in which all clauses are already satisfied is credited at once with
+ * `2^k` models, `k` being its number of unassigned variables.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef MODEL_COUNTER_H
+#define MODEL_COUNTER_H
+
+#pragma once
+
+#include "../state.h"
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+/**
+ * @brief Unsigned integer of unbounded size, enough for the `2^n` models of a problem with `n` variables.
+ */
+class model_count {
+public:
+    /**
+     * @brief Adds `2^exponent`.
+     *
+     * @param exponent The power of two to add.
+     * @return This count.
+     */
+    model_count &add_power_of_two ( std::size_t exponent );
+
+    /**
+     * @brief Adds another count.
+     *
+     * @param other The count to add.
+     * @return This count.
+     */
+    model_count &operator+= ( const model_count &other );
+
+    /**
+     * @brief Compares two counts.
+     */
+    bool operator== ( const model_count &other ) const;
+
+    /**
+     * @brief Checks whether the count is zero.
+     */
+    [[nodiscard]] bool is_zero () const;
+
+    /**
+     * @brief Converts the count to its decimal representation.
+     */
+    [[nodiscard]] std::string to_string () const;
+
+private:
+    /**
+     * @brief Removes the leading zero limbs, so equal counts have equal limbs.
+     */
+    void trim ();
+
+    std::vector<std::uint32_t> limbs; ///< The digits in base 2^32, least significant first.
+};
+
+
+/**
+ * @brief Counts, and optionally enumerates, the models of a `sat_state` problem.
+ *
+ * The search assigns a variable of the first unsatisfied clause at every node and propagates unit clauses with
+ * per-clause counters of true and false literals, so forced values never branch. A node whose clauses are all
+ * satisfied contributes `2^k` models without exploring its subtree, a node with a false clause contributes none.
+ * Variables already assigned in the initial state keep their value.
+ *
+ * The parallel version splits the top of the tree into subtrees, which the OpenMP threads take dynamically, each
+ * with its own copy of the counters and its own model count; the counts are summed at the end. Enumerated models
+ * are buffered per thread and written in blocks, one model per line as DIMACS literals over all variables
+ * (`1 -2 3 0`), in no particular order. Every node counts as one expanded state.
+ */
+class model_counter {
+public:
+    /**
+     * @brief Number of subtrees generated per thread by the parallel version.
+     */
+    static constexpr unsigned int SUBTREES_PER_THREAD = 16;
+
+    /**
+     * @brief Constructor for the model_counter class.
+     *
+     * @param initial_state The initial state of the problem, must be a `sat_state`.
+     * @throws std::invalid_argument if the initial state is not a SAT state or belongs to a preprocessed problem.
+     */
+    explicit model_counter ( const state_pointer &initial_state );
+
+    /**
+     * @brief Counts the models.
+     *
+     * @param parallel If true, the subtrees are counted on all OpenMP threads.
+     * @return The number of models, a lower bound if the count was stopped.
+     */
+    model_count count ( bool parallel );
+
+    /**
+     * @brief Counts the models and writes every one of them to a stream.
+     *
+     * @param output The stream receiving one line per model.
+     * @param parallel If true, the subtrees are counted on all OpenMP threads.
+     * @return The number of models, a lower bound if the enumeration was stopped.
+     * @throws std::invalid_argument if a satisfied subtree has 64 or more unassigned variables.
+     */
+    model_count enumerate ( std::ostream &output, bool parallel );
+
+    /**
+     * @brief Asks a running count or enumeration to stop as soon as possible.
+     */
+    void request_stop () {
+        stop_requested = true;
+    }
+
+    /**
+     * @brief Returns the number of nodes explored by the last count.
+     */
+    [[nodiscard]] unsigned long long get_expanded_states () const {
+        return expanded_states;
+    }
+
+private:
+    /**
+     * @brief Counter-based unit propagation and counting search over one copy of the clause counters.
+     */
+    class engine;
+
+    /**
+     * @brief Counts the models, writing them to `output` if it is not null.
+     */
+    model_count run ( std::ostream *output, bool parallel );
+
+    int num_variables = 0; ///< The number of variables.
+    std::vector<std::int8_t> initial_values; ///< The value of every variable in the initial state, -1 if unassigned.
+    std::vector<std::uint32_t> clause_starts; ///< Offset of every clause in `literals`, plus the end offset.
+    std::vector<int> literals; ///< The literals of the clauses left by the initial state, `2 * (variable - 1) + negated`.
+    std::vector<std::vector<std::uint32_t>> occurrences; ///< The clauses containing each literal.
+    bool contradiction = false; ///< Set if the initial state falsifies a clause.
+
+    std::atomic<bool> stop_requested { false }; ///< Set by `request_stop`.
+    std::atomic<unsigned long long> expanded_states { 0 }; ///< The number of nodes explored.
+};
+
+#endif //MODEL_COUNTER_H
@@ -0,0 +1,99 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "portfolio_solver.h"
+
+#include <thread>
+#include <exception>
+#include <algorithm>
+#include <omp.h>
+
+portfolio_solver::portfolio_solver ( const state_pointer initial_state, std::vector<engine> engines )
+    : solver( initial_state ), engines( std::move(engines) ) {
+    if ( this->engines.empty() ) throw std::invalid_argument("Portfolio needs at least one engine.");
+}
+
+state_pointer portfolio_solver::solve_seq () {
+    return race( false );
+}
+
+state_pointer portfolio_solver::solve_par () {
+    return race( true );
+}
+
+void portfolio_solver::request_stop () {
+    solver::request_stop();
+    for ( engine &engine : engines ) engine.engine_solver->request_stop();
+}
+
+std::optional<algorithm_type> portfolio_solver::get_winner () const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return winner;
+}
+
+unsigned long long portfolio_solver::get_expanded_states () const {
+    unsigned long long total = 0;
+    for ( const engine &engine : engines ) total += engine.engine_solver->get_expanded_states();
+    return total;
+}
+
+state_pointer portfolio_solver::race ( bool parallel ) {
+    state_pointer result = nullptr;
+    std::exception_ptr error = nullptr;
+    bool decided = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        winner.reset();
+    }
+
+    // Engines stopped by a previous race must be able to run again
+    for ( engine &engine : engines ) {
+        if ( stop_requested ) engine.engine_solver->request_stop();
+        else engine.engine_solver->clear_stop_request();
+    }
+
+    // Split the threads of the caller between the engines, the first engines get the remainder
+    int total_threads = omp_get_max_threads();
+    int engine_count = static_cast<int>(engines.size());
+
+    std::vector<std::thread> threads;
+    for ( int i = 0; i < engine_count; ++i ) {
+        int share = std::max(1, total_threads / engine_count + ( i < total_threads % engine_count ? 1 : 0 ));
+
+        threads.emplace_back([this, i, share, parallel, &result, &error, &decided]() {
+            engine &engine = engines[i];
+            state_pointer answer = nullptr;
+            std::exception_ptr engine_error = nullptr;
+
+            try {
+                omp_set_num_threads(share);
+                bool run_parallel = parallel && is_parallel_algorithm(engine.type);
+                answer = run_parallel ? engine.engine_solver->solve_par() : engine.engine_solver->solve_seq();
+            } catch ( ... ) {
+                engine_error = std::current_exception();
+            }
+
+            // An engine returning nullptr without being stopped has searched the whole space, that is an answer too
+            bool stopped = engine.engine_solver->is_stop_requested();
+            std::lock_guard<std::mutex> lock(mutex);
+            if ( decided ) return;
+            if ( engine_error ) {
+                error = engine_error;
+            } else if ( answer != nullptr || !stopped ) {
+                result = answer;
+                winner = engine.type;
+            } else return;
+
+            decided = true;
+            for ( size_t j = 0; j < engines.size(); ++j ) {
+                if ( static_cast<int>(j) != i ) engines[j].engine_solver->request_stop();
+            }
+        });
+    }
+
+    for ( std::thread &thread : threads ) thread.join();
+
+    if ( error ) std::rethrow_exception(error);
+    return result;
+}
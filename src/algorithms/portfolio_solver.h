@@ -0,0 +1,101 @@
+/**
+ * @file portfolio_solver.h
+ * @brief Declares the portfolio_solver class, which races several search engines on the same problem.
+ *
+ * This header file defines the `portfolio_solver` class, which inherits from the `solver` abstract base class.
+ * It runs several complete search engines concurrently, each on its own share of the available threads,
+ * returns the answer of the first engine that finishes and stops the others.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef PORTFOLIO_SOLVER_H
+#define PORTFOLIO_SOLVER_H
+
+#pragma once
+
+#include "solver.h"
+#include "../algorithm_result.h"
+#include <vector>
+#include <memory>
+#include <optional>
+#include <mutex>
+
+
+/**
+ * @brief Races several solvers on the same problem and keeps the answer of the first one to finish.
+ *
+ * All engines must be complete and optimal (e.g., BFS and IDDFS), so the first answer - a solution, or the
+ * proof that there is none - is the answer of the portfolio. The OpenMP threads are split evenly between
+ * the engines.
+ */
+class portfolio_solver : public solver {
+public:
+    /**
+     * @brief An engine taking part in the race.
+     */
+    struct engine {
+        algorithm_type type; ///< The algorithm of the engine, decides between `solve_seq` and `solve_par`.
+        std::unique_ptr<solver> engine_solver; ///< The solver running the algorithm.
+    };
+
+    /**
+     * @brief Constructor for the portfolio_solver class.
+     *
+     * @param initial_state The initial state of the problem.
+     * @param engines The engines taking part in the race (at least one).
+     * @throws std::invalid_argument if the initial state is null or no engine is given.
+     */
+    portfolio_solver ( const state_pointer initial_state, std::vector<engine> engines );
+
+    /**
+     * @brief Races the sequential variants of the engines, each on its own thread.
+     *
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     */
+    state_pointer solve_seq () override;
+
+    /**
+     * @brief Races the engines, splitting the OpenMP threads between them.
+     *
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     */
+    state_pointer solve_par () override;
+
+    /**
+     * @brief Stops the race and all engines.
+     */
+    void request_stop () override;
+
+    /**
+     * @brief Returns the engine whose answer was used by the last race.
+     *
+     * @return The algorithm of the winning engine, or no value if the race was stopped before any engine finished.
+     */
+    [[nodiscard]] std::optional<algorithm_type> get_winner () const;
+
+    /**
+     * @brief Returns the number of states expanded by all engines in the last race.
+     *
+     * The live counters of the engines are summed, so the progress of a running race can be polled.
+     *
+     * @return The number of states whose descendents were generated.
+     */
+    [[nodiscard]] unsigned long long get_expanded_states () const override;
+
+private:
+    /**
+     * @brief Runs all engines concurrently and waits until every engine has returned.
+     *
+     * @param parallel If true, the engines run their parallel variant on a share of the threads.
+     * @return The answer of the first engine that finished.
+     */
+    state_pointer race ( bool parallel );
+
+    std::vector<engine> engines; ///< The engines taking part in the race.
+    mutable std::mutex mutex; ///< Protects `winner`.
+    std::optional<algorithm_type> winner; ///< The engine whose answer was used.
+};
+
+#endif //PORTFOLIO_SOLVER_H
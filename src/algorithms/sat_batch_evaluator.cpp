@@ -0,0 +1,65 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "sat_batch_evaluator.h"
+#include "../generators/sat_generator.h"
+
+#include <stdexcept>
+
+sat_batch_evaluator::sat_batch_evaluator ( const sat_problem &problem ) : num_variables( problem.num_variables ) {
+    clause_starts.push_back(0);
+    for ( const clause &clause : problem.clauses ) {
+        for ( const literal &literal : clause.literals ) literals.push_back(2 * ( literal.variable_id - 1 ) + ( literal.negated ? 1 : 0 ));
+        clause_starts.push_back(static_cast<std::uint32_t>(literals.size()));
+    }
+}
+
+sat_batch_evaluator::batch_result sat_batch_evaluator::evaluate ( std::span<const state_pointer> states ) const {
+    if ( states.size() > BATCH_SIZE ) throw std::invalid_argument("A batch holds at most " + std::to_string(BATCH_SIZE) + " states.");
+
+    // Transpose the assignments into one slice per variable
+    std::vector<lane_mask> assigned(num_variables, lane_mask {});
+    std::vector<lane_mask> value(num_variables, lane_mask {});
+    lane_mask lanes {};
+    for ( std::size_t lane = 0; lane < states.size(); ++lane ) {
+        const auto *sat = dynamic_cast<const sat_state*>(states[lane].get());
+        if ( sat == nullptr ) throw std::invalid_argument("Batch evaluation needs SAT states.");
+
+        std::size_t word = lane / 64;
+        std::uint64_t bit = std::uint64_t(1) << ( lane % 64 );
+        lanes[word] |= bit;
+        for ( const auto &[variable, variable_value] : sat->assignment ) {
+            assigned[variable - 1][word] |= bit;
+            if ( variable_value ) value[variable - 1][word] |= bit;
+        }
+    }
+
+    // A goal assigns every variable and satisfies every clause
+    lane_mask complete = lanes;
+    for ( const lane_mask &slice : assigned ) {
+        for ( std::size_t word = 0; word < WORDS; ++word ) complete[word] &= slice[word];
+    }
+
+    batch_result result;
+    lane_mask all_satisfied = lanes;
+    for ( std::size_t clause = 0; clause + 1 < clause_starts.size(); ++clause ) {
+        lane_mask satisfied {}, open {};
+        for ( std::uint32_t i = clause_starts[clause]; i < clause_starts[clause + 1]; ++i ) {
+            const lane_mask &is_assigned = assigned[literals[i] >> 1];
+            const lane_mask &is_true = value[literals[i] >> 1];
+            std::uint64_t flip = ( literals[i] & 1 ) ? ~std::uint64_t(0) : 0;
+            for ( std::size_t word = 0; word < WORDS; ++word ) {
+                satisfied[word] |= is_assigned[word] & ( is_true[word] ^ flip );
+                open[word] |= ~is_assigned[word];
+            }
+        }
+        for ( std::size_t word = 0; word < WORDS; ++word ) {
+            all_satisfied[word] &= satisfied[word];
+            result.conflicts[word] |= ~( satisfied[word] | open[word] ) & lanes[word];
+        }
+    }
+
+    for ( std::size_t word = 0; word < WORDS; ++word ) result.goals[word] = all_satisfied[word] & complete[word];
+    return result;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file sat_batch_evaluator.h
+ * @brief Declares the sat_batch_evaluator class, which checks many SAT states at once in bit-sliced form.
+ *
+ * This header file defines the `sat_batch_evaluator` class. It transposes a batch of `sat_state` assignments so
+ * that every variable becomes a few words holding one bit per state, then evaluates each clause for the whole
+ * batch with word-wide AND/OR operations. Level-synchronous searches use it to find the goals of a level without
+ * calling `is_goal` on every state, it also reports the dead states (those falsifying a clause).
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef SAT_BATCH_EVALUATOR_H
+#define SAT_BATCH_EVALUATOR_H
+
+#pragma once
+
+#include "../state.h"
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+struct sat_problem;
+
+
+/**
+ * @brief Bit-sliced goal and conflict checks for batches of `sat_state`s of one problem.
+ *
+ * A batch holds up to `BATCH_SIZE` states, lane `i` being bit `i % 64` of word `i / 64`. For every variable, the
+ * slice `assigned` has the lanes assigning it and the slice `value` the lanes assigning it true. A clause is
+ * satisfied in the lanes of `OR(assigned & value)` over its positive literals and `OR(assigned & ~value)` over its
+ * negative ones, and false in the lanes where none of its literals is satisfied or unassigned. With `WORDS` words per
+ * slice the loops over the words are vectorized (four words fill an AVX2 register).
+ */
+class sat_batch_evaluator {
+public:
+    /**
+     * @brief Number of 64-bit words per slice.
+     */
+    static constexpr std::size_t WORDS = 4;
+
+    /**
+     * @brief Maximum number of states of one batch.
+     */
+    static constexpr std::size_t BATCH_SIZE = 64 * WORDS;
+
+    /**
+     * @brief One bit per lane of a batch.
+     */
+    using lane_mask = std::array<std::uint64_t, WORDS>;
+
+    /**
+     * @brief The outcome of evaluating a batch.
+     */
+    struct batch_result {
+        lane_mask goals {}; ///< The lanes whose state is a goal (`is_goal`).
+        lane_mask conflicts {}; ///< The lanes whose state falsifies a clause, so no descendent is a goal.
+    };
+
+    /**
+     * @brief Constructor for the sat_batch_evaluator class.
+     *
+     * @param problem The SAT problem the evaluated states belong to.
+     */
+    explicit sat_batch_evaluator ( const sat_problem &problem );
+
+    /**
+     * @brief Evaluates a batch of states.
+     *
+     * @param states Up to `BATCH_SIZE` `sat_state`s of the problem, state `i` is lane `i`.
+     * @return The goal and conflict masks, lanes past the end of `states` are clear.
+     * @throws std::invalid_argument if the batch is too large or holds a state that is not a SAT state.
+     */
+    [[nodiscard]] batch_result evaluate ( std::span<const state_pointer> states ) const;
+
+    /**
+     * @brief Checks whether a lane is set in a mask.
+     */
+    static bool test ( const lane_mask &mask, std::size_t lane ) {
+        return ( mask[lane / 64] >> ( lane % 64 ) ) & 1;
+    }
+
+private:
+    int num_variables; ///< The number of variables.
+    std::vector<std::uint32_t> clause_starts; ///< Offset of every clause in `literals`, plus the end offset.
+    std::vector<int> literals; ///< The literals of all clauses, `2 * (variable - 1) + negated`.
+};
+
+#endif //SAT_BATCH_EVALUATOR_H
@@ -0,0 +1,445 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "shm_bfs_solver.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define SHM_BFS_SUPPORTED 1
+#endif
+
+/**
+ * @brief The shared memory segment: control block, rings and visited partitions.
+ *
+ * Segment layout: `control` | `workers * workers` ring headers | ring records | `workers` visited partitions.
+ * A ring record is the identifier, the parent identifier and the encoded state. A partition is an open addressing
+ * hash table whose entries add a flag byte to the record; only its owner writes to it while the search runs.
+ */
+struct shm_bfs_solver::shared_layout {
+    struct control {
+        std::atomic<std::uint32_t> barrier_count { 0 };
+        std::atomic<std::uint32_t> barrier_generation { 0 };
+        std::atomic<std::uint32_t> abort { 0 }; ///< Set when the workers must stop (error, overflow, stop request).
+        std::atomic<std::uint32_t> failed { 0 }; ///< Set by the first worker that failed, `error` holds its message.
+        std::atomic<std::uint32_t> overflow { 0 }; ///< Set when a visited partition is full.
+        std::atomic<std::uint32_t> goal_found { 0 };
+        std::atomic<std::uint64_t> goal_identifier { ~std::uint64_t(0) }; ///< The smallest goal identifier of the goal level.
+        std::atomic<std::uint64_t> expanded_states { 0 };
+        std::atomic<std::uint64_t> level_states[3] {}; ///< Size of the next level, indexed by the level modulo 3.
+        std::atomic<std::uint32_t> finished_producers[3] {}; ///< Workers done with expanding, indexed by the level modulo 3.
+        char error[256] {};
+    };
+
+    struct ring {
+        alignas(64) std::atomic<std::uint64_t> head { 0 }; ///< Next record read by the consumer.
+        alignas(64) std::atomic<std::uint64_t> tail { 0 }; ///< Next record written by the producer.
+    };
+
+    static constexpr std::uint8_t ENTRY_USED = 1;
+    static constexpr std::uint8_t ENTRY_ROOT = 2;
+
+    int workers = 0;
+    std::size_t encoding_size = 0;
+    std::size_t record_size = 0;
+    std::size_t entry_size = 0;
+    std::size_t ring_capacity = 4096;
+    std::size_t table_slots = 0;
+
+    unsigned char *base = nullptr;
+    std::size_t bytes = 0;
+    control *ctl = nullptr;
+    ring *rings = nullptr;
+    unsigned char *ring_records = nullptr;
+    unsigned char *tables = nullptr;
+
+    /**
+     * @brief Mixes the bits of an identifier (splitmix64 finalizer), identifiers are often sequential.
+     */
+    static std::uint64_t mix ( std::uint64_t value ) {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ULL;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebULL;
+        return value ^ ( value >> 31 );
+    }
+
+    [[nodiscard]] int get_owner ( std::uint64_t identifier ) const {
+        return static_cast<int>(mix(identifier) % workers);
+    }
+
+    ring &get_ring ( int from, int to ) const {
+        return rings[from * workers + to];
+    }
+
+    [[nodiscard]] unsigned char *get_ring_record ( int from, int to, std::uint64_t index ) const {
+        std::size_t ring_index = static_cast<std::size_t>(from) * workers + to;
+        return ring_records + ( ring_index * ring_capacity + index % ring_capacity ) * record_size;
+    }
+
+    [[nodiscard]] unsigned char *get_entry ( int worker, std::size_t slot ) const {
+        return tables + ( static_cast<std::size_t>(worker) * table_slots + slot ) * entry_size;
+    }
+
+    /**
+     * @brief Finds the entry of an identifier in its owner's partition, or the free entry where it belongs.
+     */
+    [[nodiscard]] unsigned char *find_entry ( std::uint64_t identifier ) const {
+        int owner = get_owner(identifier);
+        std::size_t slot = ( mix(identifier) / workers ) & ( table_slots - 1 );
+        while ( true ) {
+            unsigned char *entry = get_entry(owner, slot);
+            if ( !( entry[16] & ENTRY_USED ) ) return entry;
+
+            std::uint64_t stored;
+            std::memcpy(&stored, entry, sizeof(stored));
+            if ( stored == identifier ) return entry;
+            slot = ( slot + 1 ) & ( table_slots - 1 );
+        }
+    }
+
+    /**
+     * @brief Stores a record in its owner's partition if the identifier is not there yet.
+     *
+     * @return `true` if the record was stored, `false` if the state was already visited.
+     */
+    bool insert ( const unsigned char *record, std::uint8_t flags ) const {
+        std::uint64_t identifier;
+        std::memcpy(&identifier, record, sizeof(identifier));
+        unsigned char *entry = find_entry(identifier);
+        if ( entry[16] & ENTRY_USED ) return false;
+
+        std::memcpy(entry, record, 16);
+        std::memcpy(entry + 24, record + 16, encoding_size);
+        entry[16] = flags;
+        return true;
+    }
+
+    /**
+     * @brief Writes the identifier, the parent identifier and the encoded state into a record.
+     */
+    void write_record ( unsigned char *record, std::uint64_t identifier, std::uint64_t parent, const std::string &encoding ) const {
+        if ( encoding.size() != encoding_size ) throw std::logic_error("All states of a problem must encode to the same size.");
+        std::memcpy(record, &identifier, sizeof(identifier));
+        std::memcpy(record + 8, &parent, sizeof(parent));
+        std::memcpy(record + 16, encoding.data(), encoding_size);
+    }
+
+    /**
+     * @brief Waits until all workers reach the barrier or the search is aborted.
+     */
+    void barrier () const {
+        std::uint32_t generation = ctl->barrier_generation.load(std::memory_order_acquire);
+        if ( ctl->barrier_count.fetch_add(1, std::memory_order_acq_rel) + 1 == static_cast<std::uint32_t>(workers) ) {
+            ctl->barrier_count.store(0, std::memory_order_relaxed);
+            ctl->barrier_generation.fetch_add(1, std::memory_order_release);
+            return;
+        }
+        while ( ctl->barrier_generation.load(std::memory_order_acquire) == generation && !ctl->abort ) sched_yield();
+    }
+
+    /**
+     * @brief Marks the search as failed with a message, only the first failure is kept.
+     */
+    void fail ( const char *message ) const {
+        std::uint32_t expected = 0;
+        if ( ctl->failed.compare_exchange_strong(expected, 1) ) {
+            std::strncpy(ctl->error, message, sizeof(ctl->error) - 1);
+        }
+        ctl->abort = 1;
+    }
+};
+
+state_pointer shm_bfs_solver::solve_seq () {
+    return search( 1 );
+}
+
+state_pointer shm_bfs_solver::solve_par () {
+    int workers = num_processes;
+    if ( workers <= 0 ) workers = std::max(1, static_cast<int>(get_numa_nodes().size()));
+    return search( workers );
+}
+
+std::vector<std::vector<int>> shm_bfs_solver::get_numa_nodes () {
+    std::vector<std::pair<int, std::vector<int>>> nodes;
+    std::error_code error;
+    for ( const auto &directory : std::filesystem::directory_iterator("/sys/devices/system/node", error) ) {
+        std::string name = directory.path().filename().string();
+        if ( name.size() <= 4 || name.compare(0, 4, "node") != 0 ) continue;
+        if ( !std::all_of(name.begin() + 4, name.end(), []( char c ) { return c >= '0' && c <= '9'; }) ) continue;
+
+        // The CPU list has the form "0-3,8-11"
+        std::ifstream file(directory.path() / "cpulist");
+        std::string range;
+        std::vector<int> cpus;
+        while ( std::getline(file, range, ',') ) {
+            int first, last;
+            char dash;
+            std::istringstream stream(range);
+            if ( !( stream >> first ) ) continue;
+            if ( !( stream >> dash >> last ) ) last = first;
+            for ( int cpu = first; cpu <= last; ++cpu ) cpus.push_back(cpu);
+        }
+        nodes.emplace_back(std::stoi(name.substr(4)), std::move(cpus));
+    }
+    std::sort(nodes.begin(), nodes.end());
+
+    std::vector<std::vector<int>> result;
+    for ( auto &node : nodes ) result.push_back(std::move(node.second));
+    return result;
+}
+
+#ifdef SHM_BFS_SUPPORTED
+
+void shm_bfs_solver::run_worker ( shared_layout &layout, int worker ) const {
+    shared_layout::control &ctl = *layout.ctl;
+    const std::size_t record_size = layout.record_size;
+    const std::uint32_t workers = layout.workers;
+
+    std::vector<state_pointer> frontier;
+    std::size_t stored = 0;
+    if ( layout.get_owner(root->get_identifier()) == worker ) {
+        frontier.push_back(root);
+        stored = 1;
+    }
+
+    std::vector<unsigned char> staged; // Records owned by this worker, generated during the current level
+    std::vector<unsigned char> record(record_size);
+
+    auto drain = [&]() {
+        for ( int from = 0; from < layout.workers; ++from ) {
+            if ( from == worker ) continue;
+            shared_layout::ring &ring = layout.get_ring(from, worker);
+            std::uint64_t head = ring.head.load(std::memory_order_relaxed);
+            std::uint64_t tail = ring.tail.load(std::memory_order_acquire);
+            for ( ; head != tail; ++head ) {
+                const unsigned char *data = layout.get_ring_record(from, worker, head);
+                staged.insert(staged.end(), data, data + record_size);
+            }
+            ring.head.store(head, std::memory_order_release);
+        }
+    };
+
+    auto send = [&]( int to ) {
+        shared_layout::ring &ring = layout.get_ring(worker, to);
+        std::uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+        // Receiving while the ring is full keeps two workers sending to each other from blocking forever
+        while ( tail - ring.head.load(std::memory_order_acquire) == layout.ring_capacity ) {
+            if ( ctl.abort ) return;
+            drain();
+            sched_yield();
+        }
+        std::memcpy(layout.get_ring_record(worker, to, tail), record.data(), record_size);
+        ring.tail.store(tail + 1, std::memory_order_release);
+    };
+
+    for ( unsigned long long level = 0; ; ++level ) {
+        int slot = static_cast<int>(level % 3);
+        // Nobody touches the counters of the next level before the barrier at the end of this one
+        if ( worker == 0 ) {
+            ctl.level_states[( level + 1 ) % 3] = 0;
+            ctl.finished_producers[( level + 1 ) % 3] = 0;
+        }
+        staged.clear();
+
+        unsigned long long expanded = 0;
+        for ( const state_pointer &current : frontier ) {
+            if ( ctl.abort ) break;
+            ++expanded;
+
+            std::uint64_t parent = current->get_identifier();
+            for ( const state_pointer &child : current->get_descendents() ) {
+                std::uint64_t identifier = child->get_identifier();
+                layout.write_record(record.data(), identifier, parent, child->encode());
+
+                int owner = layout.get_owner(identifier);
+                if ( owner == worker ) staged.insert(staged.end(), record.begin(), record.end());
+                else send(owner);
+            }
+            if ( expanded % 64 == 0 ) drain();
+        }
+        ctl.expanded_states += expanded;
+
+        // A producer increments the counter after its last send, so one drain after seeing all of them gets everything
+        ctl.finished_producers[slot].fetch_add(1, std::memory_order_acq_rel);
+        while ( ctl.finished_producers[slot].load(std::memory_order_acquire) < workers && !ctl.abort ) {
+            drain();
+            sched_yield();
+        }
+        drain();
+
+        std::vector<state_pointer> next;
+        for ( std::size_t offset = 0; offset < staged.size() && !ctl.abort; offset += record_size ) {
+            const unsigned char *data = staged.data() + offset;
+            if ( !layout.insert(data, shared_layout::ENTRY_USED) ) continue;
+
+            if ( ++stored > partition_capacity ) {
+                ctl.overflow = 1;
+                ctl.abort = 1;
+                break;
+            }
+
+            state_pointer decoded = root->decode(std::string(reinterpret_cast<const char*>(data + 16), layout.encoding_size), nullptr);
+            if ( decoded->is_goal() ) {
+                std::uint64_t identifier = decoded->get_identifier();
+                std::uint64_t best = ctl.goal_identifier.load();
+                while ( identifier < best && !ctl.goal_identifier.compare_exchange_weak(best, identifier) ) {}
+                ctl.goal_found = 1;
+            }
+            next.push_back(std::move(decoded));
+        }
+        ctl.level_states[slot] += next.size();
+
+        layout.barrier();
+        if ( ctl.abort || ctl.goal_found || ctl.level_states[slot] == 0 ) return;
+        frontier.swap(next);
+    }
+}
+
+state_pointer shm_bfs_solver::search ( int workers ) {
+    expanded_states = 0;
+    if ( stop_requested ) return nullptr;
+    if ( root->is_goal() ) return root;
+
+    shared_layout layout;
+    layout.workers = workers;
+    layout.encoding_size = root->encode().size();
+    layout.record_size = 16 + layout.encoding_size;
+    layout.entry_size = ( 24 + layout.encoding_size + 7 ) & ~std::size_t(7);
+    layout.table_slots = 1;
+    while ( layout.table_slots < 2 * partition_capacity ) layout.table_slots <<= 1;
+
+    std::size_t rings_offset = ( sizeof(shared_layout::control) + 63 ) & ~std::size_t(63);
+    std::size_t records_offset = rings_offset + sizeof(shared_layout::ring) * workers * workers;
+    std::size_t tables_offset = ( records_offset + layout.ring_capacity * layout.record_size * workers * workers + 63 ) & ~std::size_t(63);
+    layout.bytes = tables_offset + layout.table_slots * layout.entry_size * workers;
+
+    // The segment is unlinked right after mapping, the forked workers inherit the mapping
+    std::string name = "/bfs_iddfs_shm_" + std::to_string(getpid()) + "_" + std::to_string(reinterpret_cast<std::uintptr_t>(this));
+    int descriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if ( descriptor < 0 ) throw std::runtime_error("Failed to create shared memory segment: " + std::string(std::strerror(errno)));
+    shm_unlink(name.c_str());
+
+    if ( ftruncate(descriptor, static_cast<off_t>(layout.bytes)) != 0 ) {
+        std::string message = std::strerror(errno);
+        close(descriptor);
+        throw std::runtime_error("Failed to size shared memory segment: " + message);
+    }
+    void *memory = mmap(nullptr, layout.bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_NORESERVE, descriptor, 0);
+    close(descriptor);
+    if ( memory == MAP_FAILED ) throw std::runtime_error("Failed to map shared memory segment: " + std::string(std::strerror(errno)));
+
+    struct unmapper {
+        void *memory;
+        std::size_t bytes;
+        ~unmapper () { munmap(memory, bytes); }
+    } unmap_guard { memory, layout.bytes };
+
+    layout.base = static_cast<unsigned char*>(memory);
+    layout.ctl = new ( layout.base ) shared_layout::control;
+    layout.rings = reinterpret_cast<shared_layout::ring*>(layout.base + rings_offset);
+    for ( int i = 0; i < workers * workers; ++i ) new ( layout.rings + i ) shared_layout::ring;
+    layout.ring_records = layout.base + records_offset;
+    layout.tables = layout.base + tables_offset;
+
+    std::vector<unsigned char> root_record(layout.record_size);
+    layout.write_record(root_record.data(), root->get_identifier(), root->get_identifier(), root->encode());
+    layout.insert(root_record.data(), shared_layout::ENTRY_USED | shared_layout::ENTRY_ROOT);
+
+    std::vector<std::vector<int>> nodes = get_numa_nodes();
+    std::vector<pid_t> children;
+    for ( int worker = 0; worker < workers; ++worker ) {
+        pid_t pid = fork();
+        if ( pid == 0 ) {
+            // Keep every worker (and the pages it touches first) on one node
+            if ( nodes.size() > 1 && !nodes[worker % nodes.size()].empty() ) {
+                cpu_set_t cpus;
+                CPU_ZERO(&cpus);
+                for ( int cpu : nodes[worker % nodes.size()] ) CPU_SET(cpu, &cpus);
+                sched_setaffinity(0, sizeof(cpus), &cpus);
+            }
+            try {
+                run_worker(layout, worker);
+            } catch ( const std::exception &exception ) {
+                layout.fail(exception.what());
+            } catch ( ... ) {
+                layout.fail("Unknown error.");
+            }
+            // Skip the destructors and exit handlers of the parent process
+            _exit(0);
+        }
+        if ( pid < 0 ) {
+            layout.fail("Failed to fork a worker process.");
+            break;
+        }
+        children.push_back(pid);
+    }
+
+    // Wait for the workers, forwarding stop requests and publishing the progress
+    std::vector<bool> running(children.size(), true);
+    std::size_t remaining = children.size();
+    while ( remaining > 0 ) {
+        if ( stop_requested ) layout.ctl->abort = 1;
+        for ( std::size_t i = 0; i < children.size(); ++i ) {
+            if ( !running[i] ) continue;
+            int status = 0;
+            pid_t pid = waitpid(children[i], &status, WNOHANG);
+            if ( pid == 0 ) continue;
+            running[i] = false;
+            --remaining;
+            if ( pid < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0 ) layout.fail("A worker process terminated abnormally.");
+        }
+        expanded_states = layout.ctl->expanded_states.load();
+        if ( remaining > 0 ) usleep(1000);
+    }
+    expanded_states = layout.ctl->expanded_states.load();
+
+    if ( layout.ctl->failed ) throw std::runtime_error("Multi-process BFS failed: " + std::string(layout.ctl->error));
+    if ( layout.ctl->overflow ) throw std::runtime_error("Multi-process BFS failed: visited partition capacity exceeded, raise the partition capacity.");
+    if ( !layout.ctl->goal_found ) return nullptr;
+
+    // Follow the parent identifiers back to the root, then rebuild the states from the root down
+    std::vector<std::string> encodings;
+    std::uint64_t identifier = layout.ctl->goal_identifier;
+    while ( true ) {
+        const unsigned char *entry = layout.find_entry(identifier);
+        if ( entry[16] & shared_layout::ENTRY_ROOT ) break;
+        encodings.emplace_back(reinterpret_cast<const char*>(entry + 24), layout.encoding_size);
+        std::memcpy(&identifier, entry + 8, sizeof(identifier));
+    }
+
+    state_pointer current = root;
+    for ( auto encoding = encodings.rbegin(); encoding != encodings.rend(); ++encoding ) {
+        current = root->decode(*encoding, current);
+    }
+    return current;
+}
+
+#else
+
+void shm_bfs_solver::run_worker ( shared_layout &layout, int worker ) const {
+    (void) layout;
+    (void) worker;
+}
+
+state_pointer shm_bfs_solver::search ( int workers ) {
+    (void) workers;
+    throw std::runtime_error("Multi-process BFS is only supported on Linux.");
+}
+
+#endif
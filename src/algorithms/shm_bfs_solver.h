@@ -0,0 +1,92 @@
+/**
+ * @file shm_bfs_solver.h
+ * @brief Declares the shm_bfs_solver class, a Breadth-First Search running in several worker processes.
+ *
+ * This header file defines the `shm_bfs_solver` class, which inherits from the `solver` abstract base class.
+ * The search forks one worker process per NUMA node. Every state is owned by one worker, chosen by hashing its
+ * identifier; the owner keeps the visited partition and the frontier of its states. Generated states are passed
+ * to their owners through lock-free single-producer single-consumer ring buffers. The visited partitions and
+ * the rings live in a single `shm_open` segment mapped by all workers. Supported on Linux only.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef SHM_BFS_SOLVER_H
+#define SHM_BFS_SOLVER_H
+
+#pragma once
+
+#include "solver.h"
+#include <vector>
+#include <cstddef>
+
+
+/**
+ * @brief Level-synchronous BFS split between worker processes sharing memory.
+ *
+ * States cross process boundaries in their `state::encode` form, so the problem must support encoding.
+ * Each level is expanded by the owners of its states, the children are routed to their owners, deduplicated
+ * against the owner's visited partition and form the next level. A process barrier separates the levels.
+ * When a level contains a goal, the goal with the smallest identifier is chosen and its path is rebuilt
+ * from the parent identifiers stored in the visited partitions.
+ */
+class shm_bfs_solver : public solver {
+public:
+    /**
+     * @brief Constructor for the shm_bfs_solver class.
+     *
+     * @param initial_state The initial state of the problem.
+     * @param num_processes The number of worker processes used by `solve_par` (0 starts one per NUMA node).
+     * @param partition_capacity The maximum number of visited states of one worker.
+     */
+    explicit shm_bfs_solver ( const state_pointer initial_state, int num_processes = 0, std::size_t partition_capacity = 1 << 20 )
+        : solver( initial_state ), num_processes( num_processes ), partition_capacity( partition_capacity ) {}
+
+    /**
+     * @brief Solves the problem using a single worker process.
+     *
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     * @throws std::runtime_error if a worker fails, a visited partition is full or the platform is not supported.
+     */
+    state_pointer solve_seq () override;
+
+    /**
+     * @brief Solves the problem using `num_processes` worker processes, one per NUMA node by default.
+     *
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     * @throws std::runtime_error if a worker fails, a visited partition is full or the platform is not supported.
+     */
+    state_pointer solve_par () override;
+
+    /**
+     * @brief Lists the CPUs of every NUMA node of the machine.
+     *
+     * @return The CPU numbers of each node, empty if the topology is not available.
+     */
+    static std::vector<std::vector<int>> get_numa_nodes ();
+
+private:
+    struct shared_layout;
+
+    /**
+     * @brief Forks the workers, waits for them and rebuilds the solution path.
+     *
+     * @param workers The number of worker processes.
+     * @return A state_pointer to the solution state, or nullptr if no solution is found.
+     */
+    state_pointer search ( int workers );
+
+    /**
+     * @brief Runs the search of one worker process.
+     *
+     * @param layout The shared memory segment.
+     * @param worker The index of the worker.
+     */
+    void run_worker ( shared_layout &layout, int worker ) const;
+
+    int num_processes; ///< The number of worker processes used by `solve_par` (0 = one per NUMA node).
+    std::size_t partition_capacity; ///< The maximum number of visited states of one worker.
+};
+
+#endif //SHM_BFS_SOLVER_H
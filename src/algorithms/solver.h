@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <stdexcept>
+#include <atomic>
 #include "../state.h"
 
 /**
@@ -63,6 +64,41 @@ public:
      */
     virtual state_pointer solve_par () = 0;
 
+    /**
+     * @brief Returns the number of states expanded by the last call to `solve_seq` or `solve_par`.
+     *
+     * @return The number of states whose descendents were generated.
+     */
+    [[nodiscard]] virtual unsigned long long get_expanded_states () const {
+        return expanded_states;
+    }
+
+    /**
+     * @brief Asks a running search to stop as soon as possible.
+     *
+     * Can be called from any thread. A stopped search returns nullptr unless it already found a solution.
+     * A stop requested before the search starts makes it return immediately.
+     */
+    virtual void request_stop () {
+        stop_requested = true;
+    }
+
+    /**
+     * @brief Withdraws a stop request so that the solver can be run again.
+     */
+    void clear_stop_request () {
+        stop_requested = false;
+    }
+
+    /**
+     * @brief Checks whether the search was asked to stop.
+     *
+     * @return `true` if `request_stop` was called, `false` otherwise.
+     */
+    [[nodiscard]] bool is_stop_requested () const {
+        return stop_requested;
+    }
+
     /**
      * @brief Virtual destructor for the solver class.
      *
@@ -77,6 +113,19 @@ protected:
      * This shared pointer holds the root of the search tree. It is protected so that derived classes can access it.
      */
     const state_pointer root;
+
+    /**
+     * @brief The number of states expanded by the current search.
+     *
+     * Derived classes reset this counter at the start of each search and increment it whenever they
+     * generate the descendents of a state. It is read concurrently to report progress.
+     */
+    std::atomic<unsigned long long> expanded_states = 0;
+
+    /**
+     * @brief Flag set by `request_stop`, checked by derived classes while searching.
+     */
+    std::atomic<bool> stop_requested = false;
 };
 
 #endif //SOLVER_H
@@ -0,0 +1,116 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "ucs_solver.h"
+
+#include <omp.h>
+
+void ucs_solver::bucket_queue::push ( state_pointer state, unsigned long long cost ) {
+    unsigned long long index = cost - base_cost;
+    if ( index >= buckets.size() ) buckets.resize(index + 1);
+    buckets[index].push_back(std::move(state));
+}
+
+bool ucs_solver::bucket_queue::skip_empty () {
+    while ( !buckets.empty() && buckets.front().empty() ) {
+        buckets.pop_front();
+        ++base_cost;
+    }
+    return !buckets.empty();
+}
+
+void ucs_solver::relax ( const state_pointer &child, unsigned long long cost ) {
+    auto [entry, inserted] = best_cost.try_emplace(child->get_identifier(), cost);
+    if ( !inserted ) {
+        if ( entry->second <= cost ) return;
+        entry->second = cost;
+    }
+    open.push(child, cost);
+}
+
+state_pointer ucs_solver::solve_seq () {
+    open = {};
+    best_cost.clear();
+    expanded_states = 0;
+
+    best_cost[root->get_identifier()] = 0;
+    open.push(root, 0);
+
+    while ( !stop_requested && open.skip_empty() ) {
+        state_pointer current = std::move(open.buckets.front().back());
+        open.buckets.front().pop_back();
+
+        // A cheaper path to the state was found after it was queued
+        if ( best_cost[current->get_identifier()] < open.base_cost ) continue;
+
+        if ( current->is_goal() ) return current;
+
+        ++expanded_states;
+        for ( const state_pointer &child : current->get_descendents() ) {
+            unsigned int step = child->get_step_cost();
+            if ( step == 0 ) throw std::logic_error("Uniform-cost search needs step costs of at least 1.");
+            relax(child, open.base_cost + step);
+        }
+    }
+
+    return nullptr;
+}
+
+state_pointer ucs_solver::solve_par () {
+    open = {};
+    best_cost.clear();
+    expanded_states = 0;
+
+    best_cost[root->get_identifier()] = 0;
+    open.push(root, 0);
+
+    while ( !stop_requested && open.skip_empty() ) {
+        unsigned long long cost = open.base_cost;
+        std::vector<state_pointer> bucket = std::move(open.buckets.front());
+        open.buckets.pop_front();
+        ++open.base_cost;
+
+        // Drop states reached more cheaply since they were queued, pick the goal with the smallest identifier
+        std::vector<state_pointer> current;
+        current.reserve(bucket.size());
+        state_pointer goal = nullptr;
+        for ( state_pointer &state : bucket ) {
+            if ( best_cost[state->get_identifier()] < cost ) continue;
+            if ( state->is_goal() && ( goal == nullptr || state->get_identifier() < goal->get_identifier() ) ) goal = state;
+            current.push_back(std::move(state));
+        }
+        if ( goal != nullptr ) return goal;
+
+        // Expand the bucket in parallel, costs are at least 1 so no child lands in it
+        std::vector<std::pair<state_pointer, unsigned long long>> children;
+        bool invalid_cost = false;
+        unsigned long long expanded = 0;
+
+        #pragma omp parallel
+        {
+            std::vector<std::pair<state_pointer, unsigned long long>> local_children;
+
+            #pragma omp for schedule(dynamic, 64) reduction(+:expanded) reduction(||:invalid_cost)
+            for ( size_t i = 0; i < current.size(); ++i ) {
+                if ( stop_requested ) continue;
+                ++expanded;
+                for ( const state_pointer &child : current[i]->get_descendents() ) {
+                    unsigned int step = child->get_step_cost();
+                    if ( step == 0 ) invalid_cost = true;
+                    local_children.emplace_back(child, cost + step);
+                }
+            }
+
+            #pragma omp critical
+            children.insert(children.end(), std::make_move_iterator(local_children.begin()), std::make_move_iterator(local_children.end()));
+        }
+
+        expanded_states += expanded;
+        if ( invalid_cost ) throw std::logic_error("Uniform-cost search needs step costs of at least 1.");
+
+        for ( const auto &[child, child_cost] : children ) relax(child, child_cost);
+    }
+
+    return nullptr;
+}
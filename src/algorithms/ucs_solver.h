@@ -0,0 +1,91 @@
+/**
+ * @file ucs_solver.h
+ * @brief Declares the ucs_solver class, which implements Uniform-Cost Search with a bucket queue.
+ *
+ * This header file defines the `ucs_solver` class, which inherits from the `solver` abstract base class.
+ * It finds the cheapest path according to `state::get_step_cost`. Step costs are small positive integers,
+ * so the open list is Dial's bucket queue: one bucket per path cost, O(1) per push and pop.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef UCS_SOLVER_H
+#define UCS_SOLVER_H
+
+#pragma once
+
+#include "solver.h"
+#include <deque>
+#include <vector>
+#include <unordered_map>
+
+
+/**
+ * @brief Implements Uniform-Cost Search (Dijkstra's algorithm) for problems with integer step costs.
+ *
+ * The sequential version pops states one at a time from the cheapest bucket. The parallel version expands the
+ * whole cheapest bucket at once with OpenMP - all its states have the same cost, so none of them can improve
+ * another - and relaxes the children sequentially. With unit step costs both behave like BFS.
+ */
+class ucs_solver : public solver {
+public:
+    /**
+     * @brief Constructor for the ucs_solver class.
+     *
+     * @param initial_state The initial state of the problem.
+     */
+    explicit ucs_solver ( const state_pointer initial_state ) : solver( initial_state ) {}
+
+    /**
+     * @brief Solves the problem sequentially using Uniform-Cost Search.
+     *
+     * @return A state_pointer to the cheapest solution state, or nullptr if no solution is found.
+     * @throws std::logic_error if a step cost is 0.
+     */
+    state_pointer solve_seq () override;
+
+    /**
+     * @brief Solves the problem using Uniform-Cost Search, expanding each cost bucket in parallel.
+     *
+     * This implementation uses OpenMP for parallel execution.
+     *
+     * @return A state_pointer to the cheapest solution state, or nullptr if no solution is found.
+     * @throws std::logic_error if a step cost is 0.
+     */
+    state_pointer solve_par () override;
+
+private:
+    /**
+     * @brief Dial's bucket queue: bucket `i` holds the states reached with cost `base_cost + i`.
+     */
+    struct bucket_queue {
+        std::deque<std::vector<state_pointer>> buckets; ///< The buckets from the cheapest one.
+        unsigned long long base_cost = 0; ///< The cost of the first bucket.
+
+        /**
+         * @brief Adds a state with a cost not below `base_cost`.
+         */
+        void push ( state_pointer state, unsigned long long cost );
+
+        /**
+         * @brief Drops empty buckets from the front.
+         *
+         * @return `false` if the queue is empty.
+         */
+        bool skip_empty ();
+    };
+
+    /**
+     * @brief Records a cheaper cost of a state and queues it.
+     *
+     * @param child The state.
+     * @param cost The cost of the path to the state.
+     */
+    void relax ( const state_pointer &child, unsigned long long cost );
+
+    bucket_queue open; ///< The states waiting for expansion.
+    std::unordered_map<unsigned long long, unsigned long long> best_cost; ///< The cheapest known cost of every reached state.
+};
+
+#endif //UCS_SOLVER_H
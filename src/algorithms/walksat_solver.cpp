@@ -0,0 +1,245 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "walksat_solver.h"
+#include "../generators/sat_generator.h"
+#include "../preprocessing/sat_preprocessor.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <omp.h>
+
+namespace {
+    constexpr double WALKSAT_NOISE = 0.567; ///< Probability of a random walk step when every variable breaks a clause.
+    constexpr double PROBSAT_EPSILON = 0.9; ///< probSAT polynomial break function `(epsilon + break)^-cb`.
+    constexpr double PROBSAT_CB = 2.3;
+    constexpr std::size_t PROBSAT_TABLE_SIZE = 64; ///< Break counts with a precomputed weight, larger ones use the last.
+    constexpr unsigned long long CHECK_INTERVAL = 1024; ///< Flips between checks of the stop and found flags.
+
+    const std::array<double, PROBSAT_TABLE_SIZE> &probsat_weights () {
+        static const std::array<double, PROBSAT_TABLE_SIZE> weights = []() {
+            std::array<double, PROBSAT_TABLE_SIZE> table {};
+            for ( std::size_t i = 0; i < table.size(); ++i ) table[i] = std::pow(PROBSAT_EPSILON + static_cast<double>(i), -PROBSAT_CB);
+            return table;
+        }();
+        return weights;
+    }
+}
+
+struct walksat_solver::walker {
+    const walksat_solver &problem; ///< The flattened problem.
+    std::vector<std::uint8_t> values; ///< The value of every variable, 1 for true.
+    std::vector<std::uint32_t> true_count; ///< The number of true literals of every clause.
+    std::vector<std::uint32_t> true_xor; ///< The XOR of the variables of the true literals of every clause.
+    std::vector<std::uint32_t> break_count; ///< The number of clauses every variable alone satisfies.
+    std::vector<std::uint32_t> unsatisfied; ///< The unsatisfied clauses.
+    std::vector<std::uint32_t> unsatisfied_position; ///< The index of every clause in `unsatisfied`.
+    std::vector<double> cumulative; ///< Scratch space of the probSAT draw.
+
+    explicit walker ( const walksat_solver &problem ) : problem( problem ) {}
+
+    [[nodiscard]] bool is_true ( std::uint32_t literal ) const {
+        return values[literal >> 1] != ( literal & 1 );
+    }
+
+    /**
+     * @brief Starts a try from a random assignment and computes the counters from scratch.
+     */
+    void reset ( std::mt19937_64 &random ) {
+        std::size_t num_clauses = problem.clause_starts.size() - 1;
+        values.assign(problem.num_variables, 0);
+        for ( int variable = 0; variable < problem.num_variables; ++variable ) {
+            values[variable] = problem.fixed[variable] >= 0 ? static_cast<std::uint8_t>(problem.fixed[variable]) : static_cast<std::uint8_t>(random() & 1);
+        }
+
+        true_count.assign(num_clauses, 0);
+        true_xor.assign(num_clauses, 0);
+        break_count.assign(problem.num_variables, 0);
+        unsatisfied.clear();
+        unsatisfied_position.assign(num_clauses, 0);
+
+        for ( std::uint32_t clause = 0; clause < num_clauses; ++clause ) {
+            for ( std::uint32_t i = problem.clause_starts[clause]; i < problem.clause_starts[clause + 1]; ++i ) {
+                if ( is_true(problem.literals[i]) ) {
+                    ++true_count[clause];
+                    true_xor[clause] ^= problem.literals[i] >> 1;
+                }
+            }
+            if ( true_count[clause] == 0 ) {
+                unsatisfied_position[clause] = static_cast<std::uint32_t>(unsatisfied.size());
+                unsatisfied.push_back(clause);
+            } else if ( true_count[clause] == 1 ) ++break_count[true_xor[clause]];
+        }
+    }
+
+    /**
+     * @brief Flips a variable and updates the counters of the clauses it occurs in.
+     */
+    void flip ( std::uint32_t variable ) {
+        values[variable] ^= 1;
+        std::uint32_t made_true = 2 * variable + ( values[variable] ? 0 : 1 );
+
+        for ( std::uint32_t clause : problem.occurrences[made_true] ) {
+            if ( true_count[clause] == 1 ) --break_count[true_xor[clause]];
+            ++true_count[clause];
+            true_xor[clause] ^= variable;
+            if ( true_count[clause] == 1 ) {
+                // Remove from the unsatisfied list by moving the last clause into its place
+                std::uint32_t last = unsatisfied.back();
+                unsatisfied[unsatisfied_position[clause]] = last;
+                unsatisfied_position[last] = unsatisfied_position[clause];
+                unsatisfied.pop_back();
+                ++break_count[variable];
+            }
+        }
+
+        for ( std::uint32_t clause : problem.occurrences[made_true ^ 1] ) {
+            --true_count[clause];
+            true_xor[clause] ^= variable;
+            if ( true_count[clause] == 0 ) {
+                unsatisfied_position[clause] = static_cast<std::uint32_t>(unsatisfied.size());
+                unsatisfied.push_back(clause);
+                --break_count[variable];
+            } else if ( true_count[clause] == 1 ) ++break_count[true_xor[clause]];
+        }
+    }
+
+    /**
+     * @brief Chooses the variable to flip from a random unsatisfied clause.
+     */
+    std::uint32_t pick ( std::mt19937_64 &random, pick_rule rule ) {
+        std::uint32_t clause = unsatisfied[random() % unsatisfied.size()];
+        std::uint32_t begin = problem.clause_starts[clause];
+        std::uint32_t size = problem.clause_starts[clause + 1] - begin;
+
+        if ( rule == pick_rule::PROBSAT ) {
+            const auto &weights = probsat_weights();
+            cumulative.resize(size);
+            double total = 0;
+            for ( std::uint32_t i = 0; i < size; ++i ) {
+                std::uint32_t breaks = break_count[problem.literals[begin + i] >> 1];
+                total += weights[std::min<std::size_t>(breaks, weights.size() - 1)];
+                cumulative[i] = total;
+            }
+            double draw = std::uniform_real_distribution<double>(0, total)(random);
+            for ( std::uint32_t i = 0; i < size; ++i ) {
+                if ( draw < cumulative[i] ) return problem.literals[begin + i] >> 1;
+            }
+            return problem.literals[begin + size - 1] >> 1;
+        }
+
+        std::uint32_t best = problem.literals[begin] >> 1;
+        for ( std::uint32_t i = 1; i < size; ++i ) {
+            std::uint32_t variable = problem.literals[begin + i] >> 1;
+            if ( break_count[variable] < break_count[best] ) best = variable;
+        }
+        if ( break_count[best] == 0 ) return best;
+        if ( std::uniform_real_distribution<double>(0, 1)(random) < WALKSAT_NOISE ) return problem.literals[begin + random() % size] >> 1;
+        return best;
+    }
+};
+
+walksat_solver::walksat_solver ( const state_pointer initial_state, std::unique_ptr<solver> fallback, pick_rule rule,
+                                 unsigned long long max_flips, unsigned long long max_tries, std::uint64_t seed )
+    : solver( initial_state ), fallback( std::move(fallback) ), rule( rule ), max_flips( max_flips ), max_tries( max_tries ), seed( seed ) {
+    const auto *sat = dynamic_cast<const sat_state*>(root.get());
+    if ( sat == nullptr ) throw std::invalid_argument("WalkSAT needs a SAT problem.");
+    if ( max_flips == 0 ) throw std::invalid_argument("WalkSAT needs at least one flip per try.");
+
+    sat_problem problem = sat->get_problem();
+    num_variables = problem.num_variables;
+    std::map<int, bool> assignment = sat->get_assignment();
+    fixed.assign(num_variables, -1);
+    for ( const auto &[variable, value] : assignment ) fixed[variable - 1] = value ? 1 : 0;
+
+    // Only the clauses left by the fixed variables are searched
+    sat_flat_clauses flat = sat_preprocessor::flatten(problem, assignment);
+    clause_starts = std::move(flat.clause_starts);
+    literals = std::move(flat.literals);
+    contradiction = flat.contradiction;
+    occurrences.resize(2 * static_cast<std::size_t>(num_variables));
+    for ( std::uint32_t clause = 0; clause + 1 < clause_starts.size(); ++clause ) {
+        for ( std::uint32_t i = clause_starts[clause]; i < clause_starts[clause + 1]; ++i ) occurrences[literals[i]].push_back(clause);
+    }
+}
+
+state_pointer walksat_solver::solve_seq () {
+    return search(false);
+}
+
+state_pointer walksat_solver::solve_par () {
+    return search(true);
+}
+
+void walksat_solver::request_stop () {
+    solver::request_stop();
+    if ( fallback ) fallback->request_stop();
+}
+
+state_pointer walksat_solver::search ( bool parallel ) {
+    expanded_states = 0;
+    found = false;
+    tries_started = 0;
+    solved_by_local_search = false;
+
+    if ( root->is_goal() ) {
+        solved_by_local_search = true;
+        return root;
+    }
+
+    if ( !contradiction ) {
+        std::vector<std::uint8_t> model;
+
+        #pragma omp parallel if ( parallel )
+        {
+            std::mt19937_64 random(seed + 0x9E3779B97F4A7C15ULL * static_cast<std::uint64_t>(omp_get_thread_num()));
+            std::vector<std::uint8_t> local_model;
+            if ( run_tries(random, local_model) ) model = std::move(local_model);
+        }
+
+        if ( !model.empty() || ( num_variables == 0 && found ) ) {
+            solved_by_local_search = true;
+            return static_cast<const sat_state&>(*root).assign_remaining(model);
+        }
+    }
+
+    if ( fallback == nullptr || stop_requested ) return nullptr;
+
+    // The fallback is complete, it also proves unsatisfiability
+    fallback->clear_stop_request();
+    if ( stop_requested ) fallback->request_stop();
+    unsigned long long flips = expanded_states;
+    state_pointer result = parallel ? fallback->solve_par() : fallback->solve_seq();
+    expanded_states = flips + fallback->get_expanded_states();
+    return result;
+}
+
+bool walksat_solver::run_tries ( std::mt19937_64 &random, std::vector<std::uint8_t> &model ) {
+    walker walker(*this);
+
+    while ( !found && !stop_requested ) {
+        if ( max_tries != 0 && tries_started++ >= max_tries ) return false;
+        walker.reset(random);
+
+        unsigned long long flips = 0;
+        while ( !walker.unsatisfied.empty() && flips < max_flips ) {
+            walker.flip(walker.pick(random, rule));
+            if ( ++flips % CHECK_INTERVAL == 0 ) {
+                expanded_states += CHECK_INTERVAL;
+                if ( found || stop_requested ) return false;
+            }
+        }
+        expanded_states += flips % CHECK_INTERVAL;
+
+        // Only the first thread to finish publishes its model
+        if ( walker.unsatisfied.empty() && !found.exchange(true) ) {
+            model = walker.values;
+            return true;
+        }
+    }
+    return false;
+}
+
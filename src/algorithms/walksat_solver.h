@@ -0,0 +1,144 @@
+/**
+ * @file walksat_solver.h
+ * @brief Declares the walksat_solver class, a stochastic local search engine for SAT problems.
+ *
+ * This header file defines the `walksat_solver` class, which inherits from the `solver` abstract base class.
+ * Instead of building the assignment variable by variable, it starts from a random complete assignment and
+ * repeatedly flips a variable of an unsatisfied clause (WalkSAT or probSAT selection) until every clause is
+ * satisfied. It finds models of large satisfiable instances quickly but cannot prove unsatisfiability, so it can
+ * also run as a first stage in front of a complete solver.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef WALKSAT_SOLVER_H
+#define WALKSAT_SOLVER_H
+
+#pragma once
+
+#include "solver.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+/**
+ * @brief Stochastic local search (WalkSAT / probSAT) for `sat_state` problems.
+ *
+ * The clauses are flattened once, with duplicate literals merged and tautologies dropped. Every try keeps the
+ * number of true literals of each clause, the XOR of their variables (the only true variable when the count is 1),
+ * the break count of every variable (the clauses it alone satisfies) and the list of unsatisfied clauses, all
+ * updated incrementally in O(occurrences) per flip. Tries are independent restarts from a fresh random
+ * assignment; the parallel version runs them on all OpenMP threads and stops every thread at the first model.
+ *
+ * Variables already assigned in the initial state are kept fixed. The solution is returned as the chain of
+ * `sat_state`s assigning the remaining variables in order, like the complete solvers return it. Every flip counts
+ * as one expanded state.
+ */
+class walksat_solver : public solver {
+public:
+    /**
+     * @brief How the variable to flip is chosen from a random unsatisfied clause.
+     */
+    enum class pick_rule : int {
+        WALKSAT, ///< A variable with break count 0 if any, else a random one with probability `noise`, else the lowest break count.
+        PROBSAT  ///< A variable drawn with probability proportional to `(0.9 + break)^-2.3`.
+    };
+
+    /**
+     * @brief Default number of flips of one try.
+     */
+    static constexpr unsigned long long DEFAULT_MAX_FLIPS = 100000;
+
+    /**
+     * @brief Default number of tries of one search, shared by all threads.
+     */
+    static constexpr unsigned long long DEFAULT_MAX_TRIES = 100;
+
+    /**
+     * @brief Constructor for the walksat_solver class.
+     *
+     * @param initial_state The initial state of the problem, must be a `sat_state`.
+     * @param fallback Optional complete solver run on the same problem when no model is found within the budget.
+     * @param rule How the variable to flip is chosen.
+     * @param max_flips The number of flips of one try.
+     * @param max_tries The number of tries, 0 for no limit (until a model is found or the search is stopped).
+     * @param seed The seed of the random number generators.
+     * @throws std::invalid_argument if the initial state is not a SAT state or the flip budget is 0.
+     */
+    walksat_solver ( const state_pointer initial_state, std::unique_ptr<solver> fallback = nullptr, pick_rule rule = pick_rule::WALKSAT,
+                     unsigned long long max_flips = DEFAULT_MAX_FLIPS, unsigned long long max_tries = DEFAULT_MAX_TRIES, std::uint64_t seed = 1 );
+
+    /**
+     * @brief Runs the tries on one thread, then the sequential fallback if no model was found.
+     *
+     * @return A state_pointer to a satisfying assignment, or nullptr if none was found.
+     */
+    state_pointer solve_seq () override;
+
+    /**
+     * @brief Runs the tries on all OpenMP threads, then the parallel fallback if no model was found.
+     *
+     * @return A state_pointer to a satisfying assignment, or nullptr if none was found.
+     */
+    state_pointer solve_par () override;
+
+    /**
+     * @brief Stops the local search and the fallback solver.
+     */
+    void request_stop () override;
+
+    /**
+     * @brief Checks whether the last search was answered by the local search.
+     *
+     * @return `true` if the local search found the model, `false` if the answer came from the fallback (or there was none).
+     */
+    [[nodiscard]] bool is_solved_by_local_search () const {
+        return solved_by_local_search;
+    }
+
+private:
+    /**
+     * @brief The state of one try.
+     */
+    struct walker;
+
+    /**
+     * @brief Runs the local search, then the fallback.
+     *
+     * @param parallel If true, the tries run on all OpenMP threads and the fallback runs `solve_par`.
+     * @return A state_pointer to a satisfying assignment, or nullptr if none was found.
+     */
+    state_pointer search ( bool parallel );
+
+    /**
+     * @brief Runs tries until a model is found, the tries run out or the search is stopped.
+     *
+     * @param random The random number generator of the thread.
+     * @param model Receives the model, one value per variable.
+     * @return `true` if this thread found a model.
+     */
+    bool run_tries ( std::mt19937_64 &random, std::vector<std::uint8_t> &model );
+
+    std::unique_ptr<solver> fallback; ///< The complete solver run after an unsuccessful local search, may be null.
+    pick_rule rule; ///< How the variable to flip is chosen.
+    unsigned long long max_flips; ///< The number of flips of one try.
+    unsigned long long max_tries; ///< The number of tries, 0 for no limit.
+    std::uint64_t seed; ///< The seed of the random number generators.
+
+    int num_variables = 0; ///< The number of variables.
+    std::vector<std::uint32_t> clause_starts; ///< Offset of every clause in `literals`, plus the end offset.
+    std::vector<int> literals; ///< The literals of all clauses, `2 * (variable - 1) + negated`.
+    std::vector<std::vector<std::uint32_t>> occurrences; ///< The clauses containing each literal.
+    std::vector<std::int8_t> fixed; ///< -1 for a free variable, else the value of a variable assigned in the initial state.
+    bool contradiction = false; ///< Set if a clause has no literal (so the problem has no model).
+
+    std::atomic<bool> found { false }; ///< Set by the first thread that finds a model.
+    std::atomic<unsigned long long> tries_started { 0 }; ///< The number of tries started by all threads.
+    bool solved_by_local_search = false; ///< Whether the last search was answered by the local search.
+};
+
+#endif //WALKSAT_SOLVER_H
@@ -0,0 +1,147 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "wavefront_bfs_solver.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+wavefront_bfs_solver::wavefront_bfs_solver ( const state_pointer initial_state ) : solver( initial_state ) {
+    const auto *maze = dynamic_cast<const maze_state*>(root.get());
+    if ( maze == nullptr ) throw std::invalid_argument("Wavefront BFS needs a maze state.");
+    grid = maze->get_grid();
+
+    words_per_row = ( static_cast<std::size_t>(grid->columns) + 63 ) / 64;
+    open.assign(static_cast<std::size_t>(grid->rows) * words_per_row, 0);
+    goals.assign(open.size(), 0);
+    for ( int row = 0; row < grid->rows; ++row ) {
+        for ( int column = 0; column < grid->columns; ++column ) {
+            auto cell = grid->cells[static_cast<std::size_t>(row) * grid->columns + column];
+            std::uint64_t bit = std::uint64_t{ 1 } << ( column % 64 );
+            std::size_t word = static_cast<std::size_t>(row) * words_per_row + column / 64;
+            if ( cell != maze_state::WALL ) open[word] |= bit;
+            if ( cell == maze_state::GOAL ) goals[word] |= bit;
+        }
+    }
+}
+
+state_pointer wavefront_bfs_solver::solve_seq () {
+    return search(false);
+}
+
+state_pointer wavefront_bfs_solver::solve_par () {
+    return search(true);
+}
+
+state_pointer wavefront_bfs_solver::search ( bool parallel ) {
+    expanded_states = 0;
+    if ( root->is_goal() ) return root;
+
+    const int rows = grid->rows, columns = grid->columns;
+    const std::size_t words = words_per_row;
+    auto [start_row, start_column] = dynamic_cast<const maze_state&>(*root).get_position();
+
+    std::vector<std::uint64_t> visited(open.size(), 0), frontier(open.size(), 0), next(open.size(), 0);
+    std::vector<std::uint64_t> low_plane(open.size(), 0), high_plane(open.size(), 0);
+    visited[static_cast<std::size_t>(start_row) * words + start_column / 64] |= std::uint64_t{ 1 } << ( start_column % 64 );
+    frontier = visited;
+
+    std::vector<int> frontier_rows = { start_row }, candidate_rows;
+    std::vector<char> row_reached;
+    int level = 0;
+    bool found = false;
+    while ( !frontier_rows.empty() && !found && !stop_requested ) {
+        ++level;
+        const std::uint64_t low = ( level % 3 ) & 1 ? ~std::uint64_t{ 0 } : 0, high = ( level % 3 ) & 2 ? ~std::uint64_t{ 0 } : 0;
+
+        // The frontier rows are sorted, their neighbours in order give the candidate rows of the level
+        candidate_rows.clear();
+        for ( int row : frontier_rows ) {
+            for ( int candidate = std::max(row - 1, 0); candidate <= std::min(row + 1, rows - 1); ++candidate ) {
+                if ( candidate_rows.empty() || candidate_rows.back() < candidate ) candidate_rows.push_back(candidate);
+            }
+        }
+        row_reached.assign(candidate_rows.size(), 0);
+
+        unsigned long long expanded = 0;
+        const auto num_candidates = static_cast<long long>(candidate_rows.size());
+        #pragma omp parallel for schedule(static) reduction( +:expanded ) reduction( ||:found ) if( parallel && candidate_rows.size() >= PARALLEL_ROWS )
+        for ( long long i = 0; i < num_candidates; ++i ) {
+            const int row = candidate_rows[i];
+            const std::size_t begin = static_cast<std::size_t>(row) * words;
+            const std::uint64_t *current = frontier.data() + begin;
+            const std::uint64_t *above = row > 0 ? frontier.data() + begin - words : nullptr;
+            const std::uint64_t *below = row + 1 < rows ? frontier.data() + begin + words : nullptr;
+
+            std::uint64_t reached = 0, reached_goal = 0;
+            for ( std::size_t word = 0; word < words; ++word ) {
+                std::uint64_t from_left = current[word] << 1 | ( word > 0 ? current[word - 1] >> 63 : 0 );
+                std::uint64_t from_right = current[word] >> 1 | ( word + 1 < words ? current[word + 1] << 63 : 0 );
+                std::uint64_t vertical = ( above != nullptr ? above[word] : 0 ) | ( below != nullptr ? below[word] : 0 );
+                std::uint64_t cells = ( from_left | from_right | vertical ) & open[begin + word] & ~visited[begin + word];
+
+                next[begin + word] = cells;
+                visited[begin + word] |= cells;
+                low_plane[begin + word] |= cells & low;
+                high_plane[begin + word] |= cells & high;
+                reached |= cells;
+                reached_goal |= cells & goals[begin + word];
+                expanded += static_cast<unsigned long long>(std::popcount(current[word]));
+            }
+            row_reached[i] = reached != 0;
+            found = found || reached_goal != 0;
+        }
+        expanded_states += expanded;
+
+        // Only the old frontier rows hold bits, clearing them leaves an empty buffer for the level after next
+        for ( int row : frontier_rows ) {
+            std::fill_n(frontier.begin() + static_cast<std::ptrdiff_t>(static_cast<std::size_t>(row) * words), words, 0);
+        }
+        frontier.swap(next);
+        frontier_rows.clear();
+        for ( std::size_t i = 0; i < candidate_rows.size(); ++i ) {
+            if ( row_reached[i] ) frontier_rows.push_back(candidate_rows[i]);
+        }
+    }
+    if ( !found ) return nullptr;
+
+    // Any goal of the last level ends a shortest path
+    int row = -1, column = -1;
+    for ( int candidate : frontier_rows ) {
+        const std::size_t begin = static_cast<std::size_t>(candidate) * words;
+        for ( std::size_t word = 0; word < words && row < 0; ++word ) {
+            std::uint64_t cells = frontier[begin + word] & goals[begin + word];
+            if ( cells != 0 ) {
+                row = candidate;
+                column = static_cast<int>(word * 64) + std::countr_zero(cells);
+            }
+        }
+        if ( row >= 0 ) break;
+    }
+
+    // Every step back goes to a visited neighbour one level lower
+    const int row_steps[] = { 0, 0, -1, 1 };
+    const int column_steps[] = { -1, 1, 0, 0 };
+    std::vector<std::pair<int, int>> cells;
+    for ( int distance = level; distance > 0; --distance ) {
+        cells.emplace_back(row, column);
+        const int previous = ( distance - 1 ) % 3;
+        for ( int move = 0; move < 4; ++move ) {
+            int next_row = row + row_steps[move], next_column = column + column_steps[move];
+            if ( next_row < 0 || next_row >= rows || next_column < 0 || next_column >= columns ) continue;
+            if ( !test(visited, next_row, next_column) ) continue;
+            if ( test(low_plane, next_row, next_column) + 2 * test(high_plane, next_row, next_column) != previous ) continue;
+            row = next_row;
+            column = next_column;
+            break;
+        }
+    }
+
+    state_pointer path = root;
+    for ( auto it = cells.rbegin(); it != cells.rend(); ++it ) {
+        path = std::make_shared<const maze_state>(path, grid, *it);
+    }
+    return path;
+}
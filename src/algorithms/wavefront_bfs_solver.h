@@ -0,0 +1,93 @@
+/**
+ * @file wavefront_bfs_solver.h
+ * @brief Declares the wavefront_bfs_solver class, a bit-parallel BFS advancing whole maze levels with word operations.
+ *
+ * This header file defines the `wavefront_bfs_solver` class, which inherits from the `solver` abstract base class.
+ * The maze is packed into bitsets, one bit per cell, and a BFS level becomes a few shifts, ORs and ANDs per word:
+ * `next = (frontier shifted in the four directions) & open & ~visited`. No `state` object is created until the goal
+ * is reached, the path is then traced back through the levels.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef WAVEFRONT_BFS_SOLVER_H
+#define WAVEFRONT_BFS_SOLVER_H
+
+#pragma once
+
+#include "solver.h"
+#include "../generators/maze_generator.h"
+
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * @brief Bit-parallel breadth-first search for `maze_state` problems.
+ *
+ * Every row of the maze is `words_per_row` 64-bit words. A level visits only the rows next to the rows of the current
+ * frontier; a row's new cells come from its own frontier shifted one column either way (with the carry between
+ * words) and the frontiers of the rows above and below. The word loops are plain code the compiler vectorizes
+ * (AVX2 or AVX-512 with `-march=native`). The search stops at the first level holding a goal cell.
+ *
+ * Each cell stores its level modulo 3 in two bit planes. Neighbouring cells differ by at most one level, so from a
+ * cell at level `d` the neighbour at level `d - 1` is the visited one whose plane value is `(d - 1) mod 3`, and the
+ * path is traced from the goal back to the start without storing the levels.
+ *
+ * The parallel version splits the rows of each level into contiguous bands for the OpenMP threads (levels with few
+ * rows run on one thread). Moves are counted, not weighted, like in `bfs_solver`; every visited cell counts as one
+ * expanded state.
+ */
+class wavefront_bfs_solver : public solver {
+public:
+    /**
+     * @brief Minimum number of rows of a level for the parallel version to split it between the threads.
+     */
+    static constexpr std::size_t PARALLEL_ROWS = 64;
+
+    /**
+     * @brief Constructor for the wavefront_bfs_solver class, packs the maze into bitsets.
+     *
+     * @param initial_state The initial state of the problem, must be a `maze_state`.
+     * @throws std::invalid_argument if the initial state is not a maze state.
+     */
+    explicit wavefront_bfs_solver ( const state_pointer initial_state );
+
+    /**
+     * @brief Advances the levels on one thread.
+     *
+     * @return A state_pointer to the goal state, or nullptr if no goal can be reached.
+     */
+    state_pointer solve_seq () override;
+
+    /**
+     * @brief Advances the levels with their rows split between the OpenMP threads.
+     *
+     * @return A state_pointer to the goal state, or nullptr if no goal can be reached.
+     */
+    state_pointer solve_par () override;
+
+private:
+    /**
+     * @brief Runs the search.
+     *
+     * @param parallel If true, the rows of large levels are split between the threads.
+     * @return A state_pointer to the goal state, or nullptr if no goal can be reached.
+     */
+    state_pointer search ( bool parallel );
+
+    /**
+     * @brief Checks whether the bit of a cell is set in a bitset.
+     */
+    [[nodiscard]] bool test ( const std::vector<std::uint64_t> &bits, int row, int column ) const {
+        return ( bits[static_cast<std::size_t>(row) * words_per_row + column / 64] >> ( column % 64 ) ) & 1;
+    }
+
+    std::shared_ptr<const maze_state::grid_layout> grid; ///< The maze.
+    std::size_t words_per_row; ///< The number of words of a row.
+    std::vector<std::uint64_t> open; ///< The open cells.
+    std::vector<std::uint64_t> goals; ///< The goal cells.
+};
+
+#endif //WAVEFRONT_BFS_SOLVER_H
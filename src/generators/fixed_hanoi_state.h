@@ -0,0 +1,338 @@
+/**
+ * @file fixed_hanoi_state.h
+ * @brief Declares the fixed_hanoi_state class template, a Hanoi Towers state specialized for fixed peg and disc counts.
+ *
+ * This header file defines the `fixed_hanoi_state` class template. With the peg and disc counts known at compile
+ * time, the pegs are stored as bitmasks, the move list and the ranking table are `constexpr` and the move loops
+ * are unrolled. It also defines the dispatch table used by `hanoi_generator` to pick an instantiation.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef FIXED_HANOI_STATE_H
+#define FIXED_HANOI_STATE_H
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <memory>
+
+#include "hanoi_generator.h"
+
+
+/**
+ * @brief Represents a state in the Hanoi Towers problem with `Pegs` pegs and `Discs` discs.
+ *
+ * Disc `d` (1 = smallest) is stored as bit `d - 1` of the mask of the peg it lies on, so the top disc of a peg is its
+ * lowest set bit. The identifier is the rank of the configuration in base `Pegs` (digit `d - 1` is the peg of disc `d`)
+ * and is updated in O(1) per move.
+ *
+ * @tparam Pegs The number of pegs (>= 3).
+ * @tparam Discs The number of discs (>= 1).
+ */
+template <int Pegs, int Discs>
+class fixed_hanoi_state : public state, public hanoi_view, public std::enable_shared_from_this<fixed_hanoi_state<Pegs, Discs>> {
+    static_assert(Pegs >= 3, "Number of pegs must be at least 3.");
+    static_assert(Discs >= 1 && Discs <= 32, "Number of discs must be between 1 and 32.");
+
+public:
+    /**
+     * @brief Bitmask with one bit per disc.
+     */
+    using mask_type = std::uint32_t;
+
+    /**
+     * @brief Constructor for the fixed_hanoi_state class.
+     *
+     * @param predecessor A pointer to the predecessor state.
+     * @param pegs The disc mask of each peg.
+     * @param identifier The rank of the configuration.
+     * @param heuristic Optional pattern database heuristic used by `get_heuristic`, shared by all states of the problem.
+     */
+    fixed_hanoi_state ( const state_pointer predecessor, const std::array<mask_type, Pegs> &pegs, unsigned long long identifier,
+                        std::shared_ptr<const hanoi_heuristic> heuristic = nullptr )
+        : state ( predecessor ), pegs ( pegs ), identifier ( identifier ), heuristic ( std::move(heuristic) ) {}
+
+    /**
+     * @brief Creates the initial state, with all discs on the first peg.
+     *
+     * @param heuristic Optional pattern database heuristic for the states.
+     * @return A state_pointer representing the initial state.
+     */
+    static state_pointer create_initial ( std::shared_ptr<const hanoi_heuristic> heuristic ) {
+        std::array<mask_type, Pegs> initial {};
+        initial[0] = FULL_MASK;
+        return std::make_shared<const fixed_hanoi_state>(nullptr, initial, 0, std::move(heuristic));
+    }
+
+    /**
+     * @brief Generates the successor states from the current state.
+     *
+     * @return A vector of state_pointers representing the valid successor states.
+     */
+    std::vector<state_pointer> get_descendents () const override {
+        std::vector<state_pointer> children;
+        children.reserve(MOVES.size());
+
+        std::array<mask_type, Pegs> tops = get_tops();
+        for_each_move([&]( int from_peg, int to_peg ) {
+            if ( state_pointer child = make_move(tops, from_peg, to_peg) ) children.push_back(std::move(child));
+        });
+        return children;
+    }
+
+    /**
+     * @brief Yields the successor states one at a time, in the order of `get_descendents`.
+     *
+     * A coroutine body cannot yield from the unrolled lambdas, so this walks `MOVES` with a plain loop.
+     *
+     * @return A stream of the valid successor states.
+     */
+    successor_stream get_successors () const override {
+        std::array<mask_type, Pegs> tops = get_tops();
+        for ( const auto &[from_peg, to_peg] : MOVES ) {
+            if ( state_pointer child = make_move(tops, from_peg, to_peg) ) co_yield child;
+        }
+    }
+
+    /**
+     * @brief Checks if the current state is the goal state.
+     *
+     * @return True if all discs are on the last peg, false otherwise.
+     */
+    bool is_goal () const override {
+        return pegs[Pegs - 1] == FULL_MASK;
+    }
+
+    /**
+     * @brief Returns the rank of the configuration, unique for every state.
+     *
+     * @return An unsigned long long representing the unique identifier.
+     */
+    unsigned long long get_identifier () const override {
+        return identifier;
+    }
+
+    /**
+     * @brief Estimates the number of moves to the goal.
+     *
+     * @return The pattern database estimate if the problem has one, but at least the number of discs not on the last peg.
+     */
+    unsigned long long get_heuristic () const override {
+        unsigned long long off_goal = Discs - std::popcount(pegs[Pegs - 1]);
+        if ( !heuristic ) return off_goal;
+
+        std::array<std::uint8_t, Discs> disc_pegs;
+        for ( int peg = 0; peg < Pegs; ++peg ) {
+            for ( mask_type discs = pegs[peg]; discs != 0; discs &= discs - 1 ) disc_pegs[std::countr_zero(discs)] = static_cast<std::uint8_t>(peg);
+        }
+        return std::max(off_goal, heuristic->evaluate(disc_pegs.data()));
+    }
+
+    /**
+     * @brief Encodes the current state into a byte string.
+     *
+     * @return The disc masks of all pegs.
+     */
+    std::string encode () const override {
+        std::string data(sizeof(pegs), '\0');
+        std::memcpy(data.data(), pegs.data(), sizeof(pegs));
+        return data;
+    }
+
+    /**
+     * @brief Rebuilds a state of the same problem from its encoding.
+     *
+     * @param data A state encoded by `encode`.
+     * @param predecessor The predecessor of the rebuilt state.
+     * @return A shared pointer to the rebuilt state.
+     * @throws std::invalid_argument if the data is not a valid encoding of a state of this problem.
+     */
+    state_pointer decode ( const std::string &data, const state_pointer predecessor ) const override {
+        if ( data.size() != sizeof(pegs) ) throw std::invalid_argument("Invalid Hanoi state encoding.");
+        std::array<mask_type, Pegs> decoded;
+        std::memcpy(decoded.data(), data.data(), sizeof(decoded));
+
+        // Every disc lies on exactly one peg
+        mask_type placed = 0;
+        for ( mask_type discs : decoded ) {
+            if ( ( discs & placed ) != 0 || ( discs & ~FULL_MASK ) != 0 ) throw std::invalid_argument("Invalid Hanoi state encoding.");
+            placed |= discs;
+        }
+        if ( placed != FULL_MASK ) throw std::invalid_argument("Invalid Hanoi state encoding.");
+
+        unsigned long long decoded_identifier = 0;
+        for ( int peg = 1; peg < Pegs; ++peg ) {
+            for ( mask_type discs = decoded[peg]; discs != 0; discs &= discs - 1 ) {
+                decoded_identifier += RANK_WEIGHTS[std::countr_zero(discs)] * peg;
+            }
+        }
+        return std::make_shared<const fixed_hanoi_state>(predecessor, decoded, decoded_identifier, heuristic);
+    }
+
+    /**
+     * @brief Gets the current configuration of pegs and discs.
+     *
+     * @return A vector of vectors representing the pegs, each listing its discs from the bottom to the top.
+     */
+    std::vector<std::vector<int>> get_pegs () const override {
+        std::vector<std::vector<int>> result(Pegs);
+        for ( int peg = 0; peg < Pegs; ++peg ) {
+            for ( int disc = Discs; disc >= 1; --disc ) {
+                if ( pegs[peg] & (mask_type(1) << (disc - 1)) ) result[peg].push_back(disc);
+            }
+        }
+        return result;
+    }
+
+private:
+    /**
+     * @brief Mask with every disc set.
+     */
+    static constexpr mask_type FULL_MASK = Discs == 32 ? ~mask_type(0) : ( mask_type(1) << Discs ) - 1;
+
+    /**
+     * @brief Precomputes the weight of every disc in the identifier, `Pegs` to the power of the disc index.
+     *
+     * @return The weights of all discs.
+     */
+    static constexpr std::array<unsigned long long, Discs> make_rank_weights () {
+        std::array<unsigned long long, Discs> weights {};
+        unsigned long long weight = 1;
+        for ( int disc = 0; disc < Discs; ++disc ) {
+            weights[disc] = weight;
+            weight *= Pegs;
+        }
+        return weights;
+    }
+
+    /**
+     * @brief Precomputes all (from, to) peg pairs with different pegs.
+     *
+     * @return The list of moves.
+     */
+    static constexpr std::array<std::pair<int, int>, Pegs * (Pegs - 1)> make_moves () {
+        std::array<std::pair<int, int>, Pegs * (Pegs - 1)> moves {};
+        int i = 0;
+        for ( int from_peg = 0; from_peg < Pegs; ++from_peg ) {
+            for ( int to_peg = 0; to_peg < Pegs; ++to_peg ) {
+                if ( from_peg != to_peg ) moves[i++] = { from_peg, to_peg };
+            }
+        }
+        return moves;
+    }
+
+    static constexpr std::array<unsigned long long, Discs> RANK_WEIGHTS = make_rank_weights(); ///< Identifier weight of every disc.
+    static constexpr std::array<std::pair<int, int>, Pegs * (Pegs - 1)> MOVES = make_moves(); ///< All candidate moves.
+
+    static_assert(Discs * std::bit_width(static_cast<unsigned int>(Pegs - 1)) <= 64, "Identifier does not fit into 64 bits.");
+
+    /**
+     * @brief Returns the lowest set bit of each peg, 0 for an empty peg.
+     */
+    std::array<mask_type, Pegs> get_tops () const {
+        std::array<mask_type, Pegs> tops;
+        for_each_peg([&]( int peg ) { tops[peg] = pegs[peg] & (~pegs[peg] + 1); });
+        return tops;
+    }
+
+    /**
+     * @brief Moves the top disc of `from_peg` onto `to_peg`, shared by `get_descendents` and `get_successors`.
+     *
+     * @param tops The top discs of the pegs (see `get_tops`).
+     * @return The resulting state, or nullptr if the move is not allowed.
+     */
+    state_pointer make_move ( const std::array<mask_type, Pegs> &tops, int from_peg, int to_peg ) const {
+        mask_type disc = tops[from_peg];
+        if ( disc == 0 || ( tops[to_peg] != 0 && tops[to_peg] < disc ) ) return nullptr;
+
+        std::array<mask_type, Pegs> new_pegs = pegs;
+        new_pegs[from_peg] ^= disc;
+        new_pegs[to_peg] |= disc;
+
+        unsigned long long weight = RANK_WEIGHTS[std::countr_zero(disc)];
+        unsigned long long new_identifier = identifier - weight * from_peg + weight * to_peg;
+        return std::make_shared<const fixed_hanoi_state>(this->shared_from_this(), new_pegs, new_identifier, heuristic);
+    }
+
+    /**
+     * @brief Calls `function` for every peg, unrolled at compile time.
+     *
+     * @param function The function to call with the peg index.
+     */
+    template <typename function_type>
+    static void for_each_peg ( function_type &&function ) {
+        [&]<int... peg>( std::integer_sequence<int, peg...> ) {
+            ( function(peg), ... );
+        }( std::make_integer_sequence<int, Pegs>{} );
+    }
+
+    /**
+     * @brief Calls `function` for every move in `MOVES`, unrolled at compile time.
+     *
+     * @param function The function to call with the source and target peg.
+     */
+    template <typename function_type>
+    static void for_each_move ( function_type &&function ) {
+        [&]<int... move>( std::integer_sequence<int, move...> ) {
+            ( function(MOVES[move].first, MOVES[move].second), ... );
+        }( std::make_integer_sequence<int, static_cast<int>(MOVES.size())>{} );
+    }
+
+    std::array<mask_type, Pegs> pegs; ///< The disc mask of each peg.
+    unsigned long long identifier; ///< The rank of the configuration.
+    std::shared_ptr<const hanoi_heuristic> heuristic; ///< The pattern database heuristic, nullptr if none.
+};
+
+
+/**
+ * @brief Function creating the initial state of a specialized Hanoi problem.
+ */
+using fixed_hanoi_factory = state_pointer (*) ( std::shared_ptr<const hanoi_heuristic> );
+
+/**
+ * @brief Smallest number of pegs with a specialized instantiation.
+ */
+constexpr int FIXED_HANOI_MIN_PEGS = 3;
+
+/**
+ * @brief Largest number of pegs with a specialized instantiation.
+ */
+constexpr int FIXED_HANOI_MAX_PEGS = 5;
+
+/**
+ * @brief Largest number of discs with a specialized instantiation (for every supported peg count).
+ */
+constexpr int FIXED_HANOI_MAX_DISCS = 16;
+
+/**
+ * @brief Builds the dispatch table row of one peg count, with an entry for 1 to FIXED_HANOI_MAX_DISCS discs.
+ *
+ * @tparam Pegs The number of pegs.
+ * @return The factories of the row, indexed by the number of discs minus one.
+ */
+template <int Pegs, int... Discs>
+constexpr std::array<fixed_hanoi_factory, sizeof...(Discs)> make_fixed_hanoi_row ( std::integer_sequence<int, Discs...> ) {
+    return { &fixed_hanoi_state<Pegs, Discs + 1>::create_initial... };
+}
+
+/**
+ * @brief Builds the dispatch table, indexed by the number of pegs minus FIXED_HANOI_MIN_PEGS and the number of discs minus one.
+ *
+ * @return The dispatch table.
+ */
+template <int... Pegs>
+constexpr std::array<std::array<fixed_hanoi_factory, FIXED_HANOI_MAX_DISCS>, sizeof...(Pegs)> make_fixed_hanoi_table ( std::integer_sequence<int, Pegs...> ) {
+    return { make_fixed_hanoi_row<Pegs + FIXED_HANOI_MIN_PEGS>(std::make_integer_sequence<int, FIXED_HANOI_MAX_DISCS>{})... };
+}
+
+#endif //FIXED_HANOI_STATE_H
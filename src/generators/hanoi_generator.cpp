@@ -3,10 +3,30 @@
 //
 
 #include "hanoi_generator.h"
+#include "fixed_hanoi_state.h"
+
+#include <algorithm>
+#include <cstdint>
+
+// Hanoi View implementation
+void hanoi_view::print_state () const {
+    std::vector<std::vector<int>> pegs = get_pegs();
+    for ( size_t i = 0; i < pegs.size(); ++i ) {
+        std::cout << "Peg " << i << ": ";
+        for ( int disc : pegs[i] ) {
+            std::cout << disc << " ";
+        }
+        std::cout << std::endl;
+    }
+    std::cout << "----" << std::endl;
+}
 
 // Hanoi State implementation
 std::vector<state_pointer> hanoi_state::get_descendents () const {
-    std::vector<state_pointer> children;
+    return collect_successors();
+}
+
+successor_stream hanoi_state::get_successors () const {
     for ( int from_peg = 0; from_peg < num_pegs; ++from_peg ) {
         if ( pegs[from_peg].empty() ) continue;
 
@@ -20,10 +40,9 @@ std::vector<state_pointer> hanoi_state::get_descendents () const {
             new_pegs[from_peg].pop_back();
             new_pegs[to_peg].push_back(disc);
 
-            children.push_back(std::make_shared<const hanoi_state>(shared_from_this(), num_pegs, num_discs, new_pegs));
+            co_yield std::make_shared<const hanoi_state>(shared_from_this(), num_pegs, num_discs, new_pegs, heuristic);
         }
     }
-    return children;
 }
 
 bool hanoi_state::is_goal () const {
@@ -43,15 +62,35 @@ unsigned long long hanoi_state::get_identifier () const {
     return identifier;
 }
 
-void hanoi_state::print_state () const {
+unsigned long long hanoi_state::get_heuristic () const {
+    unsigned long long off_goal = num_discs - pegs.back().size();
+    if ( !heuristic ) return off_goal;
+
+    std::vector<std::uint8_t> disc_pegs(num_discs);
     for ( int i = 0; i < num_pegs; ++i ) {
-        std::cout << "Peg " << i << ": ";
-        for ( int disc : pegs[i] ) {
-            std::cout << disc << " ";
-        }
-        std::cout << std::endl;
+        for ( int disc : pegs[i] ) disc_pegs[disc - 1] = static_cast<std::uint8_t>(i);
     }
-    std::cout << "----" << std::endl;
+    return std::max(off_goal, heuristic->evaluate(disc_pegs.data()));
+}
+
+std::string hanoi_state::encode () const {
+    std::string data(num_discs, '\0');
+    for ( int i = 0; i < num_pegs; ++i ) {
+        for ( int disc : pegs[i] ) data[disc - 1] = static_cast<char>(i);
+    }
+    return data;
+}
+
+state_pointer hanoi_state::decode ( const std::string &data, const state_pointer predecessor ) const {
+    if ( static_cast<int>(data.size()) != num_discs ) throw std::invalid_argument("Invalid Hanoi state encoding.");
+    // Largest discs first, so every peg lists its discs from the bottom to the top
+    std::vector<std::vector<int>> decoded(num_pegs);
+    for ( int disc = num_discs; disc >= 1; --disc ) {
+        unsigned char peg = static_cast<unsigned char>(data[disc - 1]);
+        if ( peg >= num_pegs ) throw std::invalid_argument("Invalid Hanoi state encoding.");
+        decoded[peg].push_back(disc);
+    }
+    return std::make_shared<const hanoi_state>(predecessor, num_pegs, num_discs, decoded, heuristic);
 }
 
 std::vector<std::vector<int>> hanoi_state::get_pegs () const {
@@ -61,10 +100,17 @@ std::vector<std::vector<int>> hanoi_state::get_pegs () const {
 
 // Hanoi Generator implementation
 state_pointer hanoi_generator::generate () {
+    // Specialized instantiations for common sizes, indexed by [pegs - FIXED_HANOI_MIN_PEGS][discs - 1]
+    static constexpr auto fixed_hanoi_table = make_fixed_hanoi_table(std::make_integer_sequence<int, FIXED_HANOI_MAX_PEGS - FIXED_HANOI_MIN_PEGS + 1>{});
+
+    if ( specialized && num_pegs <= FIXED_HANOI_MAX_PEGS && num_discs <= FIXED_HANOI_MAX_DISCS ) {
+        return fixed_hanoi_table[num_pegs - FIXED_HANOI_MIN_PEGS][num_discs - 1](heuristic);
+    }
+
     std::vector<std::vector<int>> initial_pegs(num_pegs);
     for ( int i = num_discs; i >= 1; --i ) {
         initial_pegs[0].push_back(i);
     }
 
-    return std::make_shared<const hanoi_state>(nullptr, num_pegs, num_discs, initial_pegs);
+    return std::make_shared<const hanoi_state>(nullptr, num_pegs, num_discs, initial_pegs, heuristic);
 }
\ No newline at end of file
@@ -18,16 +18,47 @@
 #include <memory>
 #include <iostream>
 #include "../state.h"
+#include "../heuristics/hanoi_pattern_database.h"
 #include "generator.h"
 
 
+/**
+ * @brief Read-only view of a Hanoi Towers configuration.
+ *
+ * Implemented by all Hanoi state representations (the generic `hanoi_state` and the specialized
+ * `fixed_hanoi_state`), so that code inspecting a Hanoi state does not depend on its representation.
+ */
+class hanoi_view {
+public:
+    /**
+     * @brief Virtual destructor for the hanoi_view class.
+     */
+    virtual ~hanoi_view () = default;
+
+    /**
+     * @brief Gets the current configuration of pegs and discs.
+     *
+     * @return A vector of vectors representing the pegs, each listing its discs from the bottom to the top.
+     */
+    [[nodiscard]] virtual std::vector<std::vector<int>> get_pegs () const = 0;
+
+    /**
+     * @brief Prints the current state of the Hanoi Towers to the console.
+     *
+     * Useful for debugging and visualizing the state.
+     */
+    void print_state () const;
+};
+
+
 /**
  * @brief Represents a state in the Hanoi Towers problem.
  *
  * This class stores the configuration of the pegs and discs, and provides methods to
  * generate successor states, check for the goal state, and get a unique identifier.
+ * It supports any number of pegs and discs, `fixed_hanoi_state` is used instead for common sizes.
  */
-class hanoi_state : public state, public std::enable_shared_from_this<hanoi_state> {
+class hanoi_state : public state, public hanoi_view, public std::enable_shared_from_this<hanoi_state> {
 public:
     /**
      * @brief Constructor for the hanoi_state class.
@@ -36,9 +67,11 @@ public:
      * @param num_pegs The number of pegs.
      * @param num_discs The number of discs.
      * @param pegs A vector of vectors representing the pegs, where each inner vector contains the disc numbers on that peg.
+     * @param heuristic Optional pattern database heuristic used by `get_heuristic`, shared by all states of the problem.
      */
-    hanoi_state ( const state_pointer predecessor, int num_pegs, int num_discs, const std::vector<std::vector<int>> &pegs )
-        : state ( predecessor ), num_pegs ( num_pegs ), num_discs ( num_discs ), pegs ( pegs ) {}
+    hanoi_state ( const state_pointer predecessor, int num_pegs, int num_discs, const std::vector<std::vector<int>> &pegs,
+                  std::shared_ptr<const hanoi_heuristic> heuristic = nullptr )
+        : state ( predecessor ), num_pegs ( num_pegs ), num_discs ( num_discs ), pegs ( pegs ), heuristic ( std::move(heuristic) ) {}
 
     /**
      * @brief Generates the successor states from the current state.
@@ -47,6 +80,13 @@ public:
      */
     std::vector<state_pointer> get_descendents () const override;
 
+    /**
+     * @brief Yields the successor states one at a time.
+     *
+     * @return A stream of the valid successor states.
+     */
+    successor_stream get_successors () const override;
+
     /**
      * @brief Checks if the current state is the goal state.
      *
@@ -62,22 +102,40 @@ public:
     unsigned long long get_identifier () const override;
 
     /**
-     * @brief Prints the current state of the Hanoi Towers to the console.
+     * @brief Estimates the number of moves to the goal.
      *
-     * Useful for debugging and visualizing the state.
+     * @return The pattern database estimate if the problem has one, but at least the number of discs not on the last peg.
      */
-    void print_state () const;
+    unsigned long long get_heuristic () const override;
+
+    /**
+     * @brief Encodes the current state into a byte string.
+     *
+     * @return One byte per disc, the index of the peg the disc lies on.
+     */
+    std::string encode () const override;
+
+    /**
+     * @brief Rebuilds a state of the same problem from its encoding.
+     *
+     * @param data A state encoded by `encode`.
+     * @param predecessor The predecessor of the rebuilt state.
+     * @return A shared pointer to the rebuilt state.
+     * @throws std::invalid_argument if the data is not a valid encoding of a state of this problem.
+     */
+    state_pointer decode ( const std::string &data, const state_pointer predecessor ) const override;
 
     /**
      * @brief Gets the current configuration of pegs and discs.
      *
      * @return A vector of vectors representing the pegs.
      */
-    std::vector<std::vector<int>> get_pegs () const;
+    std::vector<std::vector<int>> get_pegs () const override;
 private:
     int num_pegs; ///< The number of pegs.
     int num_discs; ///< The number of discs.
     std::vector<std::vector<int>> pegs; ///< The configuration of pegs, each represented by a vector of disc numbers.
+    std::shared_ptr<const hanoi_heuristic> heuristic; ///< The pattern database heuristic, nullptr if none.
 };
 
 
@@ -85,6 +143,8 @@ private:
  * @brief Generator for the initial state of the Hanoi Towers problem.
  *
  * This class generates the initial state where all discs are stacked on the first peg in decreasing order of size.
+ * Common peg and disc counts are served by a `fixed_hanoi_state` instantiation picked from a dispatch table,
+ * other sizes fall back to the generic `hanoi_state`. An optional pattern database heuristic is attached to the states.
  */
 class hanoi_generator : public generator{
 public:
@@ -93,11 +153,17 @@ public:
      *
      * @param num_pegs The number of pegs (must be >= 3).
      * @param num_discs The number of discs (must be >= 1).
-     * @throws std::invalid_argument if num_pegs < 3 or num_discs < 1.
+     * @param specialized If true, use the compile-time specialized state when one exists for the size.
+     * @param heuristic Optional pattern database heuristic for the states (see `hanoi_heuristic::create`).
+     * @throws std::invalid_argument if num_pegs < 3, num_discs < 1 or the heuristic does not fit the problem.
      */
-    hanoi_generator ( int num_pegs, int num_discs ) : num_pegs ( num_pegs ), num_discs ( num_discs ) {
+    hanoi_generator ( int num_pegs, int num_discs, bool specialized = true, std::shared_ptr<const hanoi_heuristic> heuristic = nullptr )
+        : num_pegs ( num_pegs ), num_discs ( num_discs ), specialized ( specialized ), heuristic ( std::move(heuristic) ) {
         if ( num_pegs < 3 ) throw std::invalid_argument("Number of pegs must be at least 3.");
         if ( num_discs < 1 ) throw std::invalid_argument("Number of discs must be at least 1.");
+        if ( this->heuristic && ( this->heuristic->get_num_pegs() != num_pegs || this->heuristic->get_largest_disc() > num_discs ) ) {
+            throw std::invalid_argument("The pattern databases do not match the number of pegs and discs.");
+        }
     }
 
     /**
@@ -110,6 +176,8 @@ public:
 private:
     int num_pegs; ///< The number of pegs.
     int num_discs; ///< The number of discs.
+    bool specialized; ///< Whether to use `fixed_hanoi_state` for supported sizes.
+    std::shared_ptr<const hanoi_heuristic> heuristic; ///< The pattern database heuristic, nullptr if none.
 };
 
 #endif //HANOI_GENERATOR_H
@@ -3,41 +3,80 @@
 //
 
 #include "maze_generator.h"
+#include "../preprocessing/maze_contractor.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 
 // State implementation
 [[nodiscard]] std::vector<state_pointer> maze_state::get_descendents () const {
-    std::vector<state_pointer> children;
-    int x = current_position.first;
-    int y = current_position.second;
-
-    // Up, Down, Left, Right
-    int dx[] = {0, 0, -1, 1};
-    int dy[] = {-1, 1, 0, 0};
-
-    for (int i = 0; i < 4; ++i) {
-        int nx = x + dx[i];
-        int ny = y + dy[i];
+    return collect_successors();
+}
 
-        // Check if inside the grid and not a wall
-        if ( nx >= 0 && nx < static_cast<int>(grid.size()) && ny >= 0 && ny < static_cast<int>(grid[0].size()) && grid[nx][ny] != WALL ) {
-            children.push_back(std::make_shared<const maze_state>(shared_from_this(), grid, std::make_pair(nx, ny)));
-        }
+successor_stream maze_state::get_successors () const {
+    // A coroutine cannot yield from the visitor, so the open neighbours are collected first
+    std::uint32_t open[4];
+    int num_open = 0;
+    grid->for_each_neighbour(static_cast<std::uint32_t>(get_identifier()), [this, &open, &num_open]( std::uint32_t next ) {
+        if ( grid->cells[next] != WALL ) open[num_open++] = next;
+    });
+
+    for ( int i = 0; i < num_open; ++i ) {
+        std::pair<int, int> next_position { static_cast<int>(open[i]) / grid->columns, static_cast<int>(open[i]) % grid->columns };
+        co_yield std::make_shared<const maze_state>(shared_from_this(), grid, next_position);
     }
-    return children;
 }
 
 [[nodiscard]] bool maze_state::is_goal () const {
     // Check if goal
-    return grid[current_position.first][current_position.second] == GOAL;
+    return get_cell(current_position.first, current_position.second) == GOAL;
 }
 
 [[nodiscard]] unsigned long long maze_state::get_identifier () const {
-    // Simple identifier - combination of x and y
-    return (current_position.first * grid[0].size() + current_position.second);
+    // Simple identifier - index of the cell in row-major order
+    return static_cast<unsigned long long>(current_position.first) * grid->columns + current_position.second;
+}
+
+[[nodiscard]] unsigned int maze_state::get_step_cost () const {
+    return get_weight(current_position.first, current_position.second);
+}
+
+[[nodiscard]] unsigned long long maze_state::get_heuristic () const {
+    if ( grid->goal_row < 0 ) return 0;
+    return std::abs(current_position.first - grid->goal_row) + std::abs(current_position.second - grid->goal_column);
+}
+
+[[nodiscard]] std::string maze_state::encode () const {
+    std::string data(2 * sizeof(std::int32_t), '\0');
+    std::int32_t coordinates[2] = { current_position.first, current_position.second };
+    std::memcpy(data.data(), coordinates, data.size());
+    return data;
 }
 
-[[nodiscard]] maze_state::cell_type maze_state::get_cell(int x, int y) const {
-    return grid[x][y];
+[[nodiscard]] state_pointer maze_state::decode ( const std::string &data, const state_pointer predecessor ) const {
+    std::int32_t coordinates[2];
+    if ( data.size() != sizeof(coordinates) ) throw std::invalid_argument("Invalid maze state encoding.");
+    std::memcpy(coordinates, data.data(), sizeof(coordinates));
+    if ( coordinates[0] < 0 || coordinates[0] >= grid->rows || coordinates[1] < 0 || coordinates[1] >= grid->columns
+         || get_cell(coordinates[0], coordinates[1]) == WALL ) throw std::invalid_argument("Invalid maze state encoding.");
+    return std::make_shared<const maze_state>(predecessor, grid, std::make_pair(coordinates[0], coordinates[1]));
+}
+
+[[nodiscard]] maze_state::cell_type maze_state::get_cell ( int row, int column ) const {
+    return grid->cells[row * grid->columns + column];
+}
+
+[[nodiscard]] unsigned int maze_state::get_weight ( int row, int column ) const {
+    return grid->get_weight(static_cast<std::uint32_t>(row * grid->columns + column));
+}
+
+[[nodiscard]] const std::shared_ptr<const maze_state::grid_layout> &maze_state::get_grid () const {
+    return grid;
+}
+
+[[nodiscard]] std::pair<int, int> maze_state::get_position () const {
+    return current_position;
 }
 
 
@@ -66,7 +105,27 @@ state_pointer maze_generator::generate () {
 
     grid[goal_y][goal_x] = maze_state::cell_type::GOAL;
 
-    return std::make_shared<const maze_state>(nullptr, grid, std::make_pair(start_x, start_y));
+    auto layout = std::make_shared<maze_state::grid_layout>();
+    layout->rows = height;
+    layout->columns = width;
+    layout->goal_row = goal_y;
+    layout->goal_column = goal_x;
+    layout->cells.reserve(static_cast<size_t>(width) * height);
+    for ( const auto &row : grid ) layout->cells.insert(layout->cells.end(), row.begin(), row.end());
+
+    // Weights are drawn after the layout, so a seed gives the same corridors for every maximum weight
+    if ( max_weight > 1 ) {
+        std::uniform_int_distribution<> dist_weight(1, max_weight);
+        layout->weights.assign(layout->cells.size(), 1);
+        for ( size_t i = 0; i < layout->cells.size(); ++i ) {
+            if ( layout->cells[i] != maze_state::cell_type::WALL ) layout->weights[i] = static_cast<std::uint8_t>(dist_weight(random_engine));
+        }
+    }
+
+    // Positions are (row, column)
+    auto initial_state = std::make_shared<const maze_state>(nullptr, std::move(layout), std::make_pair(start_y, start_x));
+    if ( contract ) return maze_contractor::contract(*initial_state);
+    return initial_state;
 }
 
 void maze_generator::generate_maze_recursive ( std::vector<std::vector<maze_state::cell_type>> &grid, int x, int y ) {
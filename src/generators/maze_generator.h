@@ -20,13 +20,15 @@
 #include <memory>
 #include <random>
 #include <algorithm>
+#include <cstdint>
 
 
 /**
  * @brief Represents a state in the maze problem.
  *
- * This class stores the maze grid, the current position within the maze, and provides methods for
- * generating successor states, checking for the goal state, and generating a unique identifier.
+ * This class stores the current position within the maze and a pointer to the maze grid, which is shared by all
+ * states of the maze. It provides methods for generating successor states, checking for the goal state, and
+ * generating a unique identifier. Positions are (row, column) pairs.
  */
 class maze_state : public state, public std::enable_shared_from_this<maze_state> {
 public:
@@ -40,15 +42,55 @@ public:
         GOAL   ///< Represents the goal cell.
     };
 
+    /**
+     * @brief The maze grid, shared by all states of one maze.
+     */
+    struct grid_layout {
+        int rows = 0; ///< The number of rows (the height of the maze).
+        int columns = 0; ///< The number of columns (the width of the maze).
+        std::vector<cell_type> cells; ///< The cell types in row-major order.
+        std::vector<std::uint8_t> weights; ///< The cost of entering each cell in row-major order, empty if every move costs 1.
+        int goal_row = -1; ///< The row of the goal cell, -1 if unknown.
+        int goal_column = -1; ///< The column of the goal cell, -1 if unknown.
+
+        /**
+         * @brief Returns the cost of entering a cell.
+         *
+         * @param cell The cell (row-major index).
+         * @return The weight of the cell, 1 in unweighted mazes.
+         */
+        [[nodiscard]] unsigned int get_weight ( std::uint32_t cell ) const {
+            return weights.empty() ? 1 : weights[cell];
+        }
+
+        /**
+         * @brief Calls a function with every neighbour of a cell inside the grid, walls included.
+         *
+         * The neighbours are visited left, right, up, down, the order in which `maze_state` generates its moves.
+         *
+         * @param cell The cell (row-major index).
+         * @param visit The function called with the row-major index of every neighbour.
+         */
+        template<typename Visit>
+        void for_each_neighbour ( std::uint32_t cell, Visit &&visit ) const {
+            auto width = static_cast<std::uint32_t>(columns);
+            std::uint32_t column = cell % width;
+            if ( column > 0 ) visit(cell - 1);
+            if ( column + 1 < width ) visit(cell + 1);
+            if ( cell >= width ) visit(cell - width);
+            if ( cell + width < cells.size() ) visit(cell + width);
+        }
+    };
+
     /**
      * @brief Constructor for the maze_state class.
      *
      * @param predecessor A pointer to the predecessor state.
-     * @param grid The 2D vector representing the maze grid.
-     * @param start The starting position within the maze.
+     * @param grid The maze grid.
+     * @param start The current position within the maze (row, column).
      */
-    maze_state ( const state_pointer predecessor, const std::vector<std::vector<cell_type>> &grid, std::pair<int, int> start)
-        : state( predecessor ), grid( grid ), current_position( start ) {}
+    maze_state ( const state_pointer predecessor, std::shared_ptr<const grid_layout> grid, std::pair<int, int> start )
+        : state( predecessor ), grid( std::move(grid) ), current_position( start ) {}
 
     /**
      * @brief Generates the successor states (possible moves) from the current state.
@@ -57,6 +99,13 @@ public:
      */
     std::vector<state_pointer> get_descendents () const override;
 
+    /**
+     * @brief Yields the successor states one at a time.
+     *
+     * @return A stream of the valid successor states.
+     */
+    successor_stream get_successors () const override;
+
     /**
      * @brief Checks if the current state is the goal state.
      *
@@ -71,18 +120,72 @@ public:
      */
     unsigned long long get_identifier () const override;
 
+    /**
+     * @brief Returns the cost of entering the current cell.
+     *
+     * @return The weight of the current cell, 1 in unweighted mazes.
+     */
+    unsigned int get_step_cost () const override;
+
+    /**
+     * @brief Estimates the number of moves to the goal.
+     *
+     * @return The Manhattan distance to the goal cell (0 if the grid does not record the goal).
+     */
+    unsigned long long get_heuristic () const override;
+
+    /**
+     * @brief Encodes the current state into a byte string.
+     *
+     * @return The current position as two 32-bit integers.
+     */
+    std::string encode () const override;
+
+    /**
+     * @brief Rebuilds a state of the same maze from its encoding.
+     *
+     * @param data A state encoded by `encode`.
+     * @param predecessor The predecessor of the rebuilt state.
+     * @return A shared pointer to the rebuilt state.
+     * @throws std::invalid_argument if the data is not a valid encoding of an open cell of this maze.
+     */
+    state_pointer decode ( const std::string &data, const state_pointer predecessor ) const override;
+
     /**
      * @brief Gets the cell type at the specified coordinates.
      *
-     * @param x The x-coordinate.
-     * @param y The y-coordinate.
+     * @param row The row of the cell.
+     * @param column The column of the cell.
      * @return The cell_type at the specified coordinates.
      */
-    cell_type get_cell(int x, int y) const;
+    cell_type get_cell ( int row, int column ) const;
+
+    /**
+     * @brief Gets the cost of entering the cell at the specified coordinates.
+     *
+     * @param row The row of the cell.
+     * @param column The column of the cell.
+     * @return The weight of the cell, 1 in unweighted mazes.
+     */
+    unsigned int get_weight ( int row, int column ) const;
+
+    /**
+     * @brief Returns the maze grid shared by all states of the maze.
+     *
+     * @return A pointer to the grid.
+     */
+    const std::shared_ptr<const grid_layout> &get_grid () const;
+
+    /**
+     * @brief Returns the current position within the maze.
+     *
+     * @return The (row, column) pair.
+     */
+    std::pair<int, int> get_position () const;
 
 private:
-    std::vector<std::vector<cell_type>> grid; ///< The 2D vector representing the maze grid.
-    std::pair<int, int> current_position; ///< The current position within the maze (x, y).
+    std::shared_ptr<const grid_layout> grid; ///< The maze grid, shared by all states of the maze.
+    std::pair<int, int> current_position; ///< The current position within the maze (row, column).
 };
 
 
@@ -90,6 +193,7 @@ private:
  * @brief Generator for the initial state of a maze problem.
  *
  * This class generates a random maze of specified width and height using a recursive backtracking algorithm.
+ * Weighted mazes give every open cell a random cost of entering it, between 1 and the maximum weight.
  */
 class maze_generator : public generator {
 public:
@@ -99,17 +203,26 @@ public:
      * @param width The width of the maze (must be an odd number).
      * @param height The height of the maze (must be an odd number).
      * @param seed The seed for the random number generator.
-     * @throws std::invalid_argument if width or height is not an odd number.
+     * @param max_weight The maximum cost of entering a cell (1 for an unweighted maze, at most 255).
+     * @param contract If true, the maze is turned into a graph of junctions by `maze_contractor` before it is returned.
+     * @throws std::invalid_argument if width or height is not an odd number, or the maximum weight is out of range.
      */
-    maze_generator (const int width, const int height, const int seed ) : width( width ), height( height ), random_engine( seed ) {
+    maze_generator (const int width, const int height, const int seed, const int max_weight = 1, const bool contract = false )
+        : width( width ), height( height ), max_weight( max_weight ), contract( contract ), random_engine( seed ) {
         if ( width % 2 == 0 || height % 2 == 0 ) {
             throw std::invalid_argument("Width and height must be odd numbers.");
         }
+        if ( max_weight < 1 || max_weight > 255 ) {
+            throw std::invalid_argument("Maximum weight must be between 1 and 255.");
+        }
     }
 
     /**
      * @brief Generates the initial state for the maze problem.
      *
+     * With contraction, the state is a `maze_junction_state`: moves follow whole corridors, so paths count
+     * junctions instead of cells, and `maze_junction_state::expand` maps them back to the cells.
+     *
      * @return A state_pointer representing the initial state (the generated maze).
      */
     state_pointer generate () override;
@@ -126,6 +239,8 @@ private:
 
     int width; ///< The width of the maze.
     int height; ///< The height of the maze.
+    int max_weight; ///< The maximum cost of entering a cell.
+    bool contract; ///< Whether the maze is contracted to its junctions before the state is returned.
     std::default_random_engine random_engine; ///< The random number generator.
 };
 
@@ -3,12 +3,15 @@
 //
 
 #include "sat_generator.h"
+#include "../preprocessing/sat_preprocessor.h"
 
 // SAT State implementation
 std::vector<state_pointer> sat_state::get_descendents () const {
-    std::vector<state_pointer> children;
+    return collect_successors();
+}
 
-    if ( is_goal() ) return children;
+successor_stream sat_state::get_successors () const {
+    if ( is_goal() ) co_return;
 
     int next_variable = -1;
     for ( int i = 1; i <= problem.num_variables; ++i ) {
@@ -18,18 +21,15 @@ std::vector<state_pointer> sat_state::get_descendents () const {
         }
     }
 
-    if ( next_variable == -1 ) return children;
-
-    std::map<int, bool> assignment_true = assignment;
-    assignment_true[next_variable] = true;
-
-    std::map<int, bool> assignment_false = assignment;
-    assignment_false[next_variable] = false;
+    if ( next_variable == -1 ) co_return;
 
-    children.push_back(std::make_shared<const sat_state>(shared_from_this(), problem, assignment_true));
-    children.push_back(std::make_shared<const sat_state>(shared_from_this(), problem, assignment_false));
+    // The false branch is only built if the search comes back for it
+    std::map<int, bool> child_assignment = assignment;
+    child_assignment[next_variable] = true;
+    co_yield std::make_shared<const sat_state>(shared_from_this(), problem, child_assignment, preprocessing);
 
-    return children;
+    child_assignment[next_variable] = false;
+    co_yield std::make_shared<const sat_state>(shared_from_this(), problem, child_assignment, preprocessing);
 }
 
 bool sat_state::is_goal () const {
@@ -63,19 +63,68 @@ unsigned long long sat_state::get_identifier () const {
     return identifier;
 }
 
+unsigned long long sat_state::get_heuristic () const {
+    for ( const clause &clause : problem.clauses ) {
+        bool falsified = true;
+        for ( const literal &literal : clause.literals ) {
+            auto value = assignment.find(literal.variable_id);
+            if ( value == assignment.end() || value->second != literal.negated ) {
+                falsified = false;
+                break;
+            }
+        }
+        if ( falsified ) return UNREACHABLE;
+    }
+    return problem.num_variables - assignment.size();
+}
+
+std::string sat_state::encode () const {
+    std::string data(problem.num_variables, '\0');
+    for ( const auto &[variable, value] : assignment ) {
+        data[variable - 1] = value ? 2 : 1;
+    }
+    return data;
+}
+
+state_pointer sat_state::decode ( const std::string &data, const state_pointer predecessor ) const {
+    if ( static_cast<int>(data.size()) != problem.num_variables ) throw std::invalid_argument("Invalid SAT state encoding.");
+    std::map<int, bool> decoded;
+    for ( int i = 1; i <= problem.num_variables; ++i ) {
+        if ( data[i - 1] != 0 ) decoded.emplace_hint(decoded.end(), i, data[i - 1] == 2);
+    }
+    return std::make_shared<const sat_state>(predecessor, problem, decoded, preprocessing);
+}
+
 std::map<int, bool> sat_state::get_assignment () const {
     return assignment;
 }
 
+std::map<int, bool> sat_state::get_original_assignment () const {
+    return preprocessing ? preprocessing->restore(assignment) : assignment;
+}
+
 sat_problem sat_state::get_problem () const {
     return problem;
 }
 
+state_pointer sat_state::assign_remaining ( const std::vector<std::uint8_t> &values ) const {
+    std::string data = encode();
+    state_pointer current = shared_from_this();
+    for ( int variable = 0; variable < problem.num_variables; ++variable ) {
+        if ( data[variable] != 0 ) continue;
+        data[variable] = values[variable] ? 2 : 1;
+        current = decode(data, current);
+    }
+    return current;
+}
+
 
 // SAT Generator implementation
 state_pointer sat_generator::generate () {
     sat_problem problem = generate_problem();
-    return std::make_shared<const sat_state>(nullptr, problem);
+    if ( !preprocess ) return std::make_shared<const sat_state>(nullptr, problem);
+    auto result = std::make_shared<const sat_preprocessing_result>(sat_preprocessor::preprocess(problem));
+    return std::make_shared<const sat_state>(nullptr, result->problem, std::map<int, bool>{}, result);
 }
 
 sat_problem sat_generator::generate_problem () {
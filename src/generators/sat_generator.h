@@ -19,6 +19,8 @@
 #include <random>
 #include <memory>
 #include <map>
+#include <cstdint>
+#include <utility>
 
 #include "generator.h"
 #include "../state.h"
@@ -60,6 +62,8 @@ struct sat_problem {
     std::vector<clause> clauses; ///< The clauses in the problem (connected by conjunction/AND).
 };
 
+struct sat_preprocessing_result;
+
 
 /**
  * @brief Represents a state in the SAT problem.
@@ -74,9 +78,11 @@ public:
      * @param predecessor A pointer to the predecessor state.
      * @param problem     The SAT problem instance.
      * @param assignment  A map representing the current assignment of boolean values to variables.
+     * @param preprocessing The simplification `problem` came from, or nullptr if it is the original problem.
      */
-    sat_state ( const state_pointer predecessor, const sat_problem &problem, const std::map<int, bool> &assignment = {} )
-        : state ( predecessor ), problem ( problem ), assignment ( assignment ) {}
+    sat_state ( const state_pointer predecessor, const sat_problem &problem, const std::map<int, bool> &assignment = {},
+                std::shared_ptr<const sat_preprocessing_result> preprocessing = nullptr )
+        : state ( predecessor ), problem ( problem ), assignment ( assignment ), preprocessing ( std::move(preprocessing) ) {}
 
     /**
      * @brief Generates the successor states from the current state by assigning true/false to the next unassigned variable.
@@ -85,6 +91,13 @@ public:
      */
     std::vector<state_pointer> get_descendents () const override;
 
+    /**
+     * @brief Yields the successor states one at a time.
+     *
+     * @return A stream of the valid successor states.
+     */
+    successor_stream get_successors () const override;
+
     /**
      * @brief Checks if the current state is a goal state (i.e., a satisfying assignment).
      *
@@ -99,6 +112,29 @@ public:
      */
     unsigned long long get_identifier () const override;
 
+    /**
+     * @brief Returns the number of moves to a goal, as variables are assigned one per move.
+     *
+     * @return The number of unassigned variables, or `UNREACHABLE` if a clause is already falsified.
+     */
+    unsigned long long get_heuristic () const override;
+
+    /**
+     * @brief Encodes the current state into a byte string.
+     *
+     * @return One byte per variable: 0 if unassigned, 1 if false, 2 if true.
+     */
+    std::string encode () const override;
+
+    /**
+     * @brief Rebuilds a state of the same problem from its encoding.
+     *
+     * @param data A state encoded by `encode`.
+     * @param predecessor The predecessor of the rebuilt state.
+     * @return A shared pointer to the rebuilt state.
+     */
+    state_pointer decode ( const std::string &data, const state_pointer predecessor ) const override;
+
     /**
      * @brief Returns the current variable assignment.
      *
@@ -106,6 +142,26 @@ public:
      */
     std::map<int, bool> get_assignment () const;
 
+    /**
+     * @brief Returns the current assignment in the variables of the original problem.
+     *
+     * For a state of a preprocessed problem the assignment is mapped back through
+     * `sat_preprocessing_result::restore`, so a goal state yields a model of the problem that was generated or loaded.
+     * Without preprocessing it equals `get_assignment`.
+     *
+     * @return A map representing the assignment of the original variables.
+     */
+    std::map<int, bool> get_original_assignment () const;
+
+    /**
+     * @brief Checks whether the state belongs to a preprocessed problem.
+     *
+     * @return True if the problem was simplified by `sat_preprocessor`, false if it is the original problem.
+     */
+    bool is_preprocessed () const {
+        return preprocessing != nullptr;
+    }
+
     /**
      * @brief Returns the SAT problem instance.
      *
@@ -113,9 +169,21 @@ public:
      */
     sat_problem get_problem () const;
 
+    /**
+     * @brief Builds the chain of states assigning the unassigned variables in increasing order, the order
+     *        `get_descendents` assigns them in, so solvers that find a model directly return a regular path.
+     *
+     * @param values The value of every variable (0 or 1), indexed by its identifier minus one.
+     * @return The last state of the chain, this state if every variable is already assigned.
+     */
+    state_pointer assign_remaining ( const std::vector<std::uint8_t> &values ) const;
+
 private:
+    friend class sat_batch_evaluator; // Reads the assignments of whole batches without copying them
+
     sat_problem problem; ///< The SAT problem instance.
     std::map<int, bool> assignment; ///< The current assignment of boolean values to variables.
+    std::shared_ptr<const sat_preprocessing_result> preprocessing; ///< The simplification of the problem, shared by all its states, or nullptr.
 };
 
 
@@ -131,16 +199,21 @@ public:
      * @param num_clauses              The number of clauses.
      * @param max_literals_per_clause The maximum number of literals allowed in a single clause.
      * @param seed                     The seed for the random number generator.
+     * @param preprocess               If true, the problem is simplified by `sat_preprocessor` before the state is built.
      * @throws std::invalid_argument if num_vars, num_clauses, or max_literals_per_clause is not positive.
      */
-    sat_generator ( int num_vars, int num_clauses, int max_literals_per_clause, int seed )
-        : num_variables ( num_vars ), num_clauses ( num_clauses ), max_literals_per_clause ( max_literals_per_clause ), random_engine ( seed ) {
+    sat_generator ( int num_vars, int num_clauses, int max_literals_per_clause, int seed, bool preprocess = false )
+        : num_variables ( num_vars ), num_clauses ( num_clauses ), max_literals_per_clause ( max_literals_per_clause ), preprocess ( preprocess ), random_engine ( seed ) {
         if ( num_vars <= 0 || num_clauses <= 0 || max_literals_per_clause <= 0 ) throw std::invalid_argument("Number of variables, clauses, and max literals per clause must be positive.");
     }
 
     /**
      * @brief Generates an initial state for the SAT problem (an empty assignment).
      *
+     * With preprocessing, the state belongs to the simplified problem: its variables are renumbered and the
+     * eliminated ones are gone, so paths are shorter than the original number of variables. The states keep the
+     * preprocessing result, `sat_state::get_original_assignment` maps their assignments back.
+     *
      * @return A state_pointer representing the initial state.
      */
     state_pointer generate () override;
@@ -156,6 +229,7 @@ private:
     int num_variables; ///< The number of boolean variables.
     int num_clauses; ///< The number of clauses.
     int max_literals_per_clause; ///< The maximum number of literals per clause.
+    bool preprocess; ///< Whether the problem is simplified before the state is built.
     std::default_random_engine random_engine; ///< The random number generator.
 };
 
@@ -0,0 +1,270 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "hanoi_pattern_database.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+#include <omp.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HANOI_PDB_MMAP_SUPPORTED 1
+#endif
+
+namespace {
+    /**
+     * @brief Header of a saved table, followed by `num_entries` distance bytes.
+     */
+    struct file_header {
+        char magic[8]; ///< "HANOIPDB".
+        std::uint32_t version; ///< `FILE_VERSION`.
+        std::uint32_t num_pegs; ///< The number of pegs.
+        std::uint32_t first_disc; ///< The smallest disc of the group.
+        std::uint32_t num_discs; ///< The number of discs in the group.
+        std::uint64_t num_entries; ///< The number of distance bytes.
+    };
+
+    constexpr char FILE_MAGIC[8] = { 'H', 'A', 'N', 'O', 'I', 'P', 'D', 'B' };
+    constexpr std::uint32_t FILE_VERSION = 1;
+    constexpr std::uint8_t UNVISITED = 0xFF; ///< Marks entries the BFS has not reached yet.
+
+    /**
+     * @brief Checks a header read from a file.
+     */
+    void check_header ( const file_header &header, std::uint64_t payload_size, const std::string &filename ) {
+        if ( std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || header.version != FILE_VERSION ) {
+            throw std::runtime_error("Not a Hanoi pattern database: " + filename);
+        }
+        unsigned long long expected = 1;
+        for ( std::uint32_t i = 0; i < header.num_discs && expected <= hanoi_pattern_database::MAX_ENTRIES; ++i ) expected *= header.num_pegs;
+        if ( header.num_pegs < 3 || header.first_disc < 1 || header.num_discs < 1 || header.num_entries != expected || payload_size != expected ) {
+            throw std::runtime_error("Corrupted Hanoi pattern database: " + filename);
+        }
+    }
+}
+
+std::shared_ptr<const hanoi_pattern_database> hanoi_pattern_database::build ( int num_pegs, int first_disc, int num_discs ) {
+    if ( num_pegs < 3 ) throw std::invalid_argument("Number of pegs must be at least 3.");
+    if ( first_disc < 1 || num_discs < 1 ) throw std::invalid_argument("A pattern database needs a positive first disc and disc count.");
+
+    std::vector<unsigned long long> weights(num_discs);
+    unsigned long long num_entries = 1;
+    for ( int i = 0; i < num_discs; ++i ) {
+        weights[i] = num_entries;
+        num_entries *= num_pegs;
+        if ( num_entries > MAX_ENTRIES ) throw std::invalid_argument("Pattern database is too large, use fewer discs per pattern.");
+    }
+
+    std::shared_ptr<hanoi_pattern_database> database(new hanoi_pattern_database(num_pegs, first_disc, num_discs, num_entries));
+    std::vector<std::uint8_t> &table = database->owned;
+    table.assign(num_entries, UNVISITED);
+
+    // Level-synchronous BFS from the goal (every disc on the last peg), entries are claimed with a CAS
+    std::vector<std::uint32_t> current_level;
+    std::vector<std::uint32_t> next_level = { static_cast<std::uint32_t>(num_entries - 1) };
+    table[num_entries - 1] = 0;
+
+    for ( unsigned int depth = 1; !next_level.empty(); ++depth ) {
+        current_level = std::exchange(next_level, {});
+        std::uint8_t stored = static_cast<std::uint8_t>(std::min(depth, MAX_DISTANCE));
+
+        #pragma omp parallel
+        {
+            std::vector<std::uint32_t> local_next;
+            std::vector<int> pegs(num_discs);
+            std::vector<int> tops(num_pegs);
+
+            #pragma omp for schedule(dynamic, 1024)
+            for ( size_t i = 0; i < current_level.size(); ++i ) {
+                unsigned long long index = current_level[i];
+                for ( int disc = 0; disc < num_discs; ++disc ) {
+                    pegs[disc] = static_cast<int>(index % num_pegs);
+                    index /= num_pegs;
+                }
+
+                // The top of a peg is its smallest disc, num_discs if the peg is empty
+                std::fill(tops.begin(), tops.end(), num_discs);
+                for ( int disc = num_discs - 1; disc >= 0; --disc ) tops[pegs[disc]] = disc;
+
+                for ( int from_peg = 0; from_peg < num_pegs; ++from_peg ) {
+                    int disc = tops[from_peg];
+                    if ( disc == num_discs ) continue;
+                    for ( int to_peg = 0; to_peg < num_pegs; ++to_peg ) {
+                        if ( to_peg == from_peg || tops[to_peg] < disc ) continue;
+
+                        std::uint32_t neighbour = static_cast<std::uint32_t>(current_level[i] + weights[disc] * to_peg - weights[disc] * from_peg);
+                        std::atomic_ref<std::uint8_t> entry(table[neighbour]);
+                        std::uint8_t expected = UNVISITED;
+                        if ( entry.load(std::memory_order_relaxed) == UNVISITED && entry.compare_exchange_strong(expected, stored, std::memory_order_relaxed) ) {
+                            local_next.push_back(neighbour);
+                        }
+                    }
+                }
+            }
+
+            #pragma omp critical
+            next_level.insert(next_level.end(), local_next.begin(), local_next.end());
+        }
+    }
+
+    database->distances = table.data();
+    return database;
+}
+
+std::shared_ptr<const hanoi_pattern_database> hanoi_pattern_database::load ( const std::string &filename ) {
+#ifdef HANOI_PDB_MMAP_SUPPORTED
+    int descriptor = ::open(filename.c_str(), O_RDONLY);
+    if ( descriptor < 0 ) throw std::runtime_error("Cannot open pattern database: " + filename);
+
+    struct stat file_stat {};
+    if ( ::fstat(descriptor, &file_stat) != 0 || static_cast<std::size_t>(file_stat.st_size) < sizeof(file_header) ) {
+        ::close(descriptor);
+        throw std::runtime_error("Corrupted Hanoi pattern database: " + filename);
+    }
+
+    std::size_t size = static_cast<std::size_t>(file_stat.st_size);
+    void *mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+    ::close(descriptor);
+    if ( mapping == MAP_FAILED ) throw std::runtime_error("Cannot map pattern database: " + filename);
+
+    file_header header;
+    std::memcpy(&header, mapping, sizeof(header));
+    try {
+        check_header(header, size - sizeof(header), filename);
+    } catch ( ... ) {
+        ::munmap(mapping, size);
+        throw;
+    }
+
+    std::shared_ptr<hanoi_pattern_database> database(new hanoi_pattern_database(static_cast<int>(header.num_pegs), static_cast<int>(header.first_disc),
+                                                                                static_cast<int>(header.num_discs), header.num_entries));
+    database->mapping = mapping;
+    database->mapping_size = size;
+    database->distances = static_cast<const std::uint8_t*>(mapping) + sizeof(header);
+    return database;
+#else
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if ( !file.is_open() ) throw std::runtime_error("Cannot open pattern database: " + filename);
+
+    std::streamoff size = file.tellg();
+    if ( size < static_cast<std::streamoff>(sizeof(file_header)) ) throw std::runtime_error("Corrupted Hanoi pattern database: " + filename);
+    file.seekg(0);
+
+    file_header header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    check_header(header, static_cast<std::uint64_t>(size) - sizeof(header), filename);
+
+    std::shared_ptr<hanoi_pattern_database> database(new hanoi_pattern_database(static_cast<int>(header.num_pegs), static_cast<int>(header.first_disc),
+                                                                                static_cast<int>(header.num_discs), header.num_entries));
+    database->owned.resize(header.num_entries);
+    file.read(reinterpret_cast<char*>(database->owned.data()), static_cast<std::streamsize>(header.num_entries));
+    if ( !file ) throw std::runtime_error("Cannot read pattern database: " + filename);
+    database->distances = database->owned.data();
+    return database;
+#endif
+}
+
+void hanoi_pattern_database::save ( const std::string &filename ) const {
+    // Written under a temporary name and renamed, so a concurrent loader never maps a partial table
+    std::string temporary = filename + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if ( !file.is_open() ) throw std::runtime_error("Cannot write pattern database: " + filename);
+
+        file_header header {};
+        std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+        header.version = FILE_VERSION;
+        header.num_pegs = static_cast<std::uint32_t>(num_pegs);
+        header.first_disc = static_cast<std::uint32_t>(first_disc);
+        header.num_discs = static_cast<std::uint32_t>(num_discs);
+        header.num_entries = num_entries;
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(distances), static_cast<std::streamsize>(num_entries));
+        if ( !file ) throw std::runtime_error("Cannot write pattern database: " + filename);
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, filename, error);
+    if ( error ) throw std::runtime_error("Cannot write pattern database: " + filename + ": " + error.message());
+}
+
+hanoi_pattern_database::~hanoi_pattern_database () {
+#ifdef HANOI_PDB_MMAP_SUPPORTED
+    if ( mapping != nullptr ) ::munmap(mapping, mapping_size);
+#endif
+}
+
+
+hanoi_heuristic::hanoi_heuristic ( std::vector<std::shared_ptr<const hanoi_pattern_database>> databases, combination rule )
+    : databases ( std::move(databases) ), rule ( rule ) {
+    if ( this->databases.empty() ) throw std::invalid_argument("A Hanoi heuristic needs at least one pattern database.");
+
+    for ( const auto &database : this->databases ) {
+        if ( database->get_num_pegs() != get_num_pegs() ) throw std::invalid_argument("All pattern databases must have the same number of pegs.");
+    }
+
+    if ( rule == combination::ADDITIVE ) {
+        std::vector<bool> covered(get_largest_disc() + 1, false);
+        for ( const auto &database : this->databases ) {
+            for ( int disc = database->get_first_disc(); disc < database->get_first_disc() + database->get_num_discs(); ++disc ) {
+                if ( covered[disc] ) throw std::invalid_argument("Additive pattern databases must cover disjoint discs.");
+                covered[disc] = true;
+            }
+        }
+    }
+}
+
+std::shared_ptr<const hanoi_heuristic> hanoi_heuristic::create ( int num_pegs, int num_discs, int pattern_size, const std::string &cache_directory ) {
+    if ( num_discs < 1 ) throw std::invalid_argument("Number of discs must be at least 1.");
+    if ( pattern_size < 1 ) throw std::invalid_argument("Pattern size must be at least 1.");
+
+    std::vector<std::shared_ptr<const hanoi_pattern_database>> databases;
+    for ( int last_disc = num_discs; last_disc >= 1; last_disc -= pattern_size ) {
+        int group_size = std::min(pattern_size, last_disc);
+        int first_disc = last_disc - group_size + 1;
+
+        if ( cache_directory.empty() ) {
+            databases.push_back(hanoi_pattern_database::build(num_pegs, first_disc, group_size));
+            continue;
+        }
+
+        std::filesystem::path path = std::filesystem::path(cache_directory)
+            / ( "hanoi_pdb_" + std::to_string(num_pegs) + "_" + std::to_string(first_disc) + "_" + std::to_string(group_size) + ".pdb" );
+        if ( std::filesystem::exists(path) ) {
+            databases.push_back(hanoi_pattern_database::load(path.string()));
+        } else {
+            std::filesystem::create_directories(cache_directory);
+            auto database = hanoi_pattern_database::build(num_pegs, first_disc, group_size);
+            database->save(path.string());
+            databases.push_back(std::move(database));
+        }
+    }
+
+    return std::make_shared<const hanoi_heuristic>(std::move(databases), combination::ADDITIVE);
+}
+
+unsigned long long hanoi_heuristic::evaluate ( const std::uint8_t *disc_pegs ) const {
+    unsigned long long estimate = 0;
+    for ( const auto &database : databases ) {
+        unsigned long long distance = database->get_distance(disc_pegs);
+        estimate = rule == combination::ADDITIVE ? estimate + distance : std::max(estimate, distance);
+    }
+    return estimate;
+}
+
+int hanoi_heuristic::get_largest_disc () const {
+    int largest = 0;
+    for ( const auto &database : databases ) largest = std::max(largest, database->get_first_disc() + database->get_num_discs() - 1);
+    return largest;
+}
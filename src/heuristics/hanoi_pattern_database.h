@@ -0,0 +1,199 @@
+/**
+ * @file hanoi_pattern_database.h
+ * @brief Declares the hanoi_pattern_database and hanoi_heuristic classes, pattern database heuristics for Hanoi Towers.
+ *
+ * This header file defines the `hanoi_pattern_database` class, a table of the exact number of moves needed to bring
+ * a group of discs to the last peg while every other disc is ignored, and the `hanoi_heuristic` class, which combines
+ * several tables into an admissible estimate of the moves left. Tables are built by a level-synchronous parallel BFS
+ * over the abstract states and can be saved to files that are later mapped into memory instead of being rebuilt.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef HANOI_PATTERN_DATABASE_H
+#define HANOI_PATTERN_DATABASE_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+/**
+ * @brief Pattern database of one group of consecutive discs.
+ *
+ * The abstract state is the peg of every disc of the group (the other discs are removed), ranked in base `num_pegs`
+ * with the smallest disc of the group as the lowest digit. Each entry holds one byte, the number of moves from the
+ * abstract state to the goal (all discs of the group on the last peg), saturated at `MAX_DISTANCE` so the table
+ * stays a lower bound. A group of `k` discs takes `num_pegs^k` bytes.
+ *
+ * File format: a fixed header (magic, version, pegs, first disc, disc count, entry count) followed by the entries,
+ * so a saved table can be mapped and used without parsing.
+ */
+class hanoi_pattern_database {
+public:
+    /**
+     * @brief Largest distance stored in a table, longer distances are stored as this value.
+     */
+    static constexpr unsigned int MAX_DISTANCE = 254;
+
+    /**
+     * @brief Largest number of entries of a table (1 GiB).
+     */
+    static constexpr unsigned long long MAX_ENTRIES = 1ULL << 30;
+
+    /**
+     * @brief Builds the table of a disc group with a parallel BFS from the goal.
+     *
+     * Moves can be undone, so the distance from the goal is the distance to the goal.
+     *
+     * @param num_pegs The number of pegs (>= 3).
+     * @param first_disc The smallest disc of the group (1 = the smallest disc of the problem).
+     * @param num_discs The number of discs in the group.
+     * @return The table.
+     * @throws std::invalid_argument if a parameter is out of range or the table would exceed `MAX_ENTRIES`.
+     */
+    static std::shared_ptr<const hanoi_pattern_database> build ( int num_pegs, int first_disc, int num_discs );
+
+    /**
+     * @brief Maps a table saved by `save` into memory (reads it where mapping is not supported).
+     *
+     * @param filename The name of the file.
+     * @return The table.
+     * @throws std::runtime_error if the file cannot be opened or is not a valid table.
+     */
+    static std::shared_ptr<const hanoi_pattern_database> load ( const std::string &filename );
+
+    /**
+     * @brief Saves the table to a file.
+     *
+     * @param filename The name of the file.
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    void save ( const std::string &filename ) const;
+
+    /**
+     * @brief Looks up the distance of the group in a configuration.
+     *
+     * @param disc_pegs The peg of every disc of the problem, indexed by the disc number minus one.
+     * @return The number of moves of the group's discs needed to reach the goal (at most `MAX_DISTANCE`).
+     */
+    [[nodiscard]] unsigned int get_distance ( const std::uint8_t *disc_pegs ) const {
+        unsigned long long index = 0;
+        for ( int i = num_discs - 1; i >= 0; --i ) index = index * num_pegs + disc_pegs[first_disc - 1 + i];
+        return distances[index];
+    }
+
+    /**
+     * @brief Returns the number of pegs of the table.
+     */
+    [[nodiscard]] int get_num_pegs () const { return num_pegs; }
+
+    /**
+     * @brief Returns the smallest disc of the group.
+     */
+    [[nodiscard]] int get_first_disc () const { return first_disc; }
+
+    /**
+     * @brief Returns the number of discs in the group.
+     */
+    [[nodiscard]] int get_num_discs () const { return num_discs; }
+
+    /**
+     * @brief Destructor, unmaps a loaded table.
+     */
+    ~hanoi_pattern_database ();
+
+    hanoi_pattern_database ( const hanoi_pattern_database& ) = delete;
+    hanoi_pattern_database &operator= ( const hanoi_pattern_database& ) = delete;
+
+private:
+    /**
+     * @brief Constructor for an empty table of a disc group, used by `build` and `load`.
+     */
+    hanoi_pattern_database ( int num_pegs, int first_disc, int num_discs, unsigned long long num_entries )
+        : num_pegs ( num_pegs ), first_disc ( first_disc ), num_discs ( num_discs ), num_entries ( num_entries ) {}
+
+    int num_pegs; ///< The number of pegs.
+    int first_disc; ///< The smallest disc of the group.
+    int num_discs; ///< The number of discs in the group.
+    unsigned long long num_entries; ///< The number of entries, `num_pegs^num_discs`.
+    std::vector<std::uint8_t> owned; ///< The entries of a built (or read) table.
+    const std::uint8_t *distances = nullptr; ///< The entries, in `owned` or in the mapping.
+    void *mapping = nullptr; ///< The mapped file of a loaded table, nullptr if not mapped.
+    std::size_t mapping_size = 0; ///< The size of the mapping in bytes.
+};
+
+
+/**
+ * @brief Admissible Hanoi heuristic combining pattern databases.
+ *
+ * With the additive rule the groups must be disjoint: every move moves a disc of at most one group, so the sum of
+ * the group distances never exceeds the true distance. With the maximum rule the groups may overlap.
+ */
+class hanoi_heuristic {
+public:
+    /**
+     * @brief How the distances of the tables are combined.
+     */
+    enum class combination : int {
+        ADDITIVE, ///< Sum of the distances, the groups must be disjoint.
+        MAX       ///< Largest of the distances.
+    };
+
+    /**
+     * @brief Constructor for the hanoi_heuristic class.
+     *
+     * @param databases The tables, all for the same number of pegs.
+     * @param rule How the distances are combined.
+     * @throws std::invalid_argument if there are no tables, their peg counts differ or additive groups overlap.
+     */
+    hanoi_heuristic ( std::vector<std::shared_ptr<const hanoi_pattern_database>> databases, combination rule );
+
+    /**
+     * @brief Creates an additive heuristic splitting the discs into groups of at most `pattern_size` discs.
+     *
+     * The largest discs form the first group, the smallest discs the last (possibly smaller) one. With a cache
+     * directory, every table is mapped from `<directory>/hanoi_pdb_<pegs>_<first disc>_<discs>.pdb` if the file
+     * exists, or built and saved there otherwise.
+     *
+     * @param num_pegs The number of pegs.
+     * @param num_discs The number of discs of the problem.
+     * @param pattern_size The largest number of discs in a group.
+     * @param cache_directory The directory the tables are kept in, empty to always build them.
+     * @return The heuristic.
+     * @throws std::invalid_argument if a parameter is out of range.
+     * @throws std::runtime_error if a cached table cannot be read or written.
+     */
+    static std::shared_ptr<const hanoi_heuristic> create ( int num_pegs, int num_discs, int pattern_size, const std::string &cache_directory = "" );
+
+    /**
+     * @brief Estimates the number of moves to the goal.
+     *
+     * @param disc_pegs The peg of every disc, indexed by the disc number minus one.
+     * @return A lower bound on the number of moves to bring every disc to the last peg.
+     */
+    [[nodiscard]] unsigned long long evaluate ( const std::uint8_t *disc_pegs ) const;
+
+    /**
+     * @brief Returns the number of pegs of the tables.
+     */
+    [[nodiscard]] int get_num_pegs () const { return databases.front()->get_num_pegs(); }
+
+    /**
+     * @brief Returns the largest disc covered by a table, problems must have at least this many discs.
+     *
+     * @return The largest covered disc.
+     */
+    [[nodiscard]] int get_largest_disc () const;
+
+private:
+    std::vector<std::shared_ptr<const hanoi_pattern_database>> databases; ///< The tables.
+    combination rule; ///< How the distances are combined.
+};
+
+#endif //HANOI_PATTERN_DATABASE_H
@@ -11,12 +11,22 @@
 */
 
 #include <iostream>
+#include <fstream>
+#include <chrono>
 #include <string>
 #include <stdexcept>
 #include <map>
+#include <utility>
+#include <vector>
 
 #include "problem_loader.h"
 #include "algorithm_benchmark.h"
+#include "solver_server.h"
+#include "algorithms/maze_replanner.h"
+#include "algorithms/model_counter.h"
+#include "preprocessing/maze_contractor.h"
+#include "preprocessing/maze_hierarchy.h"
+#include "preprocessing/maze_tree_index.h"
 #include "generators/maze_generator.h"
 #include "generators/sat_generator.h"
 #include "generators/hanoi_generator.h"
@@ -35,7 +45,40 @@ bool is_sequential = false;
 bool is_bfs = false;
 bool is_iddfs = false;
 bool is_help = false;
+bool is_portfolio = false;
+bool is_serve = false;
+bool is_shm_bfs = false;
+bool is_dist_bfs = false;
+bool is_ucs = false;
+bool is_beam = false;
+bool is_frontier_bfs = false;
+bool is_walksat = false;
+bool is_walksat_first = false;
+bool is_probsat = false;
+bool is_preprocess = false;
+bool is_contract = false;
+bool is_components = false;
+bool is_cube = false;
+bool is_gray_code = false;
+bool is_jps = false;
+bool is_wavefront = false;
+bool is_count = false;
+int max_weight = 1;
+int num_processes = 0;
+std::size_t partition_capacity = 0;
+int beam_width = 0;
+int cube_depth = 0;
+int route_queries = 0;
+int hpa_cluster_size = 0;
+int replan_rounds = 0;
+int pdb_size = 0;
+std::string pdb_directory;
+int dist_rank = -1;
+int dist_size = 0;
+std::string dist_endpoint;
 std::string filename;
+std::string models_filename;
+std::string socket_path;
 
 
 /**
@@ -79,6 +122,38 @@ void generate_problem ();
  */
 void benchmark_algorithms ();
 
+/**
+ * @brief Counts the models of a SAT problem, optionally writing all of them to a file.
+ *
+ * Runs the sequential and the parallel model counter (only one of them with --sequential or --parallel, only the
+ * parallel one when enumerating unless --sequential is given) and prints the number of models and the time.
+ *
+ * @param initial_state The initial state of the SAT problem.
+ */
+void count_models ( const state_pointer &initial_state );
+
+/**
+ * @brief Answers random path queries on a maze through a `maze_tree_index`.
+ *
+ * Builds the index (or with --hpa the hierarchy, cached next to a maze file), answers `route_queries` distance and
+ * cost queries between random open cells and prints the times, then checks the query from the start to the goal
+ * against a sequential UCS.
+ *
+ * @param initial_state The initial state of the maze, plain or contracted.
+ */
+void answer_route_queries ( const state_pointer &initial_state );
+
+/**
+ * @brief Replans the path of a maze through a `maze_replanner` while its cells change.
+ *
+ * Plans once, then toggles a random cell between wall and path `replan_rounds` times, replanning after each edit and
+ * comparing the cost with a sequential UCS on the edited maze from scratch. Prints the times and expanded states of
+ * both.
+ *
+ * @param initial_state The initial state of the maze, plain or contracted.
+ */
+void replan_changing_maze ( const state_pointer &initial_state );
+
 
 /**
  * @brief Main function of the program.
@@ -99,7 +174,10 @@ int main ( int argc, char** argv ) {
             return 0;
         }
 
-        if ( is_generate ) {
+        if ( is_serve ) {
+            solver_server server(socket_path);
+            server.serve();
+        } else if ( is_generate ) {
             generate_problem();
         } else {
             benchmark_algorithms();
@@ -138,12 +216,166 @@ void parse_arguments ( int argc, char *argv[] ) {
             is_iddfs = true;
         } else if ( arg == "--help" || arg == "-H" ) {
             is_help = true;
+        } else if ( arg == "--portfolio" ) {
+            is_portfolio = true;
+        } else if ( arg == "--shm-bfs" ) {
+            is_shm_bfs = true;
+        } else if ( arg == "--processes" ) {
+            if ( i + 1 < argc ) {
+                num_processes = std::stoi(argv[++i]);
+                if ( num_processes < 1 ) throw std::runtime_error("Error: --processes must be at least 1.");
+            } else throw std::runtime_error("Error: Missing process count after --processes.");
+        } else if ( arg == "--partition-capacity" ) {
+            if ( i + 1 < argc ) {
+                std::string value = argv[++i];
+                if ( value.empty() || value[0] == '-' || ( partition_capacity = std::stoull(value) ) < 1 ) throw std::runtime_error("Error: --partition-capacity must be at least 1.");
+            } else throw std::runtime_error("Error: Missing state count after --partition-capacity.");
+        } else if ( arg == "--ucs" ) {
+            is_ucs = true;
+        } else if ( arg == "--frontier-bfs" ) {
+            is_frontier_bfs = true;
+        } else if ( arg == "--walksat" ) {
+            is_walksat = true;
+        } else if ( arg == "--walksat-first" ) {
+            is_walksat_first = true;
+        } else if ( arg == "--probsat" ) {
+            is_probsat = true;
+        } else if ( arg == "--gray-code" ) {
+            is_gray_code = true;
+        } else if ( arg == "--jps" ) {
+            is_jps = true;
+        } else if ( arg == "--wavefront" ) {
+            is_wavefront = true;
+        } else if ( arg == "--cube" ) {
+            is_cube = true;
+        } else if ( arg == "--cube-depth" ) {
+            if ( i + 1 < argc ) {
+                cube_depth = std::stoi(argv[++i]);
+                if ( cube_depth < 1 ) throw std::runtime_error("Error: --cube-depth must be at least 1.");
+            } else throw std::runtime_error("Error: Missing depth after --cube-depth.");
+        } else if ( arg == "--count" ) {
+            is_count = true;
+        } else if ( arg == "--enumerate" ) {
+            is_count = true;
+            if ( i + 1 < argc ) {
+                models_filename = argv[++i];
+            } else throw std::runtime_error("Error: Missing filename after --enumerate.");
+        } else if ( arg == "--route-queries" ) {
+            if ( i + 1 < argc ) {
+                route_queries = std::stoi(argv[++i]);
+                if ( route_queries < 1 ) throw std::runtime_error("Error: --route-queries must be at least 1.");
+            } else throw std::runtime_error("Error: Missing count after --route-queries.");
+        } else if ( arg == "--hpa" ) {
+            if ( i + 1 < argc ) {
+                hpa_cluster_size = std::stoi(argv[++i]);
+                if ( hpa_cluster_size < 1 || hpa_cluster_size > maze_hierarchy::MAX_CLUSTER_SIZE ) throw std::runtime_error("Error: --hpa must be between 1 and " + std::to_string(maze_hierarchy::MAX_CLUSTER_SIZE) + ".");
+            } else throw std::runtime_error("Error: Missing cluster size after --hpa.");
+        } else if ( arg == "--replan" ) {
+            if ( i + 1 < argc ) {
+                replan_rounds = std::stoi(argv[++i]);
+                if ( replan_rounds < 1 ) throw std::runtime_error("Error: --replan must be at least 1.");
+            } else throw std::runtime_error("Error: Missing round count after --replan.");
+        } else if ( arg == "--components" ) {
+            is_components = true;
+        } else if ( arg == "--preprocess" ) {
+            is_preprocess = true;
+        } else if ( arg == "--contract" ) {
+            is_contract = true;
+        } else if ( arg == "--beam" ) {
+            is_beam = true;
+        } else if ( arg == "--beam-width" ) {
+            if ( i + 1 < argc ) {
+                beam_width = std::stoi(argv[++i]);
+                if ( beam_width < 1 ) throw std::runtime_error("Error: --beam-width must be at least 1.");
+            } else throw std::runtime_error("Error: Missing width after --beam-width.");
+        } else if ( arg == "--pdb" ) {
+            if ( i + 1 < argc ) {
+                pdb_size = std::stoi(argv[++i]);
+                if ( pdb_size < 1 ) throw std::runtime_error("Error: --pdb must be at least 1.");
+            } else throw std::runtime_error("Error: Missing pattern size after --pdb.");
+        } else if ( arg == "--pdb-dir" ) {
+            if ( i + 1 < argc ) {
+                pdb_directory = argv[++i];
+            } else throw std::runtime_error("Error: Missing directory after --pdb-dir.");
+        } else if ( arg == "--max-weight" ) {
+            if ( i + 1 < argc ) {
+                max_weight = std::stoi(argv[++i]);
+            } else throw std::runtime_error("Error: Missing weight after --max-weight.");
+        } else if ( arg == "--dist-bfs" ) {
+            is_dist_bfs = true;
+        } else if ( arg == "--dist-rank" ) {
+            if ( i + 1 < argc ) {
+                dist_rank = std::stoi(argv[++i]);
+            } else throw std::runtime_error("Error: Missing rank after --dist-rank.");
+        } else if ( arg == "--dist-size" ) {
+            if ( i + 1 < argc ) {
+                dist_size = std::stoi(argv[++i]);
+            } else throw std::runtime_error("Error: Missing size after --dist-size.");
+        } else if ( arg == "--dist-endpoint" ) {
+            if ( i + 1 < argc ) {
+                dist_endpoint = argv[++i];
+            } else throw std::runtime_error("Error: Missing endpoint after --dist-endpoint.");
+        } else if ( arg == "--serve" ) {
+            is_serve = true;
+            if ( i + 1 < argc ) {
+                socket_path = argv[++i];
+            } else throw std::runtime_error("Error: Missing socket path after --serve.");
         } else throw std::runtime_error("Error: Unknown argument: " + arg);
     }
 
+    // The options choosing the search algorithms, --count, --route-queries and --replan replace all of them
+    const std::vector<std::pair<bool, const char*>> algorithm_options = {
+        { is_bfs, "--bfs" }, { is_iddfs, "--iddfs" }, { is_portfolio, "--portfolio" }, { is_ucs, "--ucs" }, { is_beam, "--beam" }, { is_frontier_bfs, "--frontier-bfs" },
+        { is_shm_bfs, "--shm-bfs" }, { num_processes != 0, "--processes" }, { partition_capacity != 0, "--partition-capacity" },
+        { is_dist_bfs, "--dist-bfs" }, { dist_rank != -1, "--dist-rank" }, { dist_size != 0, "--dist-size" }, { !dist_endpoint.empty(), "--dist-endpoint" },
+        { is_walksat, "--walksat" }, { is_walksat_first, "--walksat-first" }, { is_cube, "--cube" }, { is_gray_code, "--gray-code" }, { is_jps, "--jps" },
+        { is_wavefront, "--wavefront" }
+    };
+    // The options that only configure a benchmark run, --serve and --generate take none of them
+    std::vector<std::pair<bool, const char*>> benchmark_options = {
+        { is_parallel, "--parallel" }, { is_sequential, "--sequential" }, { beam_width != 0, "--beam-width" }, { is_probsat, "--probsat" }, { is_preprocess, "--preprocess" },
+        { is_contract, "--contract" }, { is_components, "--components" }, { cube_depth != 0, "--cube-depth" }, { is_count, models_filename.empty() ? "--count" : "--enumerate" },
+        { route_queries != 0, "--route-queries" }, { hpa_cluster_size != 0, "--hpa" }, { replan_rounds != 0, "--replan" }, { max_weight != 1, "--max-weight" },
+        { pdb_size != 0, "--pdb" }, { !pdb_directory.empty(), "--pdb-dir" }
+    };
+    benchmark_options.insert(benchmark_options.end(), algorithm_options.begin(), algorithm_options.end());
+
+    auto find_given = []( const std::vector<std::pair<bool, const char*>> &options ) -> const char* {
+        for ( const auto &[given, name] : options ) {
+            if ( given ) return name;
+        }
+        return nullptr;
+    };
+    const char *algorithm_option = find_given(algorithm_options);
+    const char *benchmark_option = find_given(benchmark_options);
+
+    if ( is_serve && (is_maze || is_sat || is_hanoi || is_file || is_generate || benchmark_option) ) throw std::runtime_error("Error: --serve cannot be used with other options, clients choose the problem and algorithm per request.");
     if ( (is_maze + is_sat + is_hanoi + is_file) > 1 ) throw std::runtime_error("Error: Only one of --maze, --sat, --hanoi, or --file can be specified.");
     if ( (is_maze + is_sat + is_hanoi + is_file) < 1 && !is_generate ) is_sat = true;
-    if ( is_generate && (is_parallel || is_sequential || is_bfs || is_iddfs) ) throw std::runtime_error("Error: --generate cannot be used with --parallel, --sequential, --bfs, or --iddfs.");
+    if ( is_generate && benchmark_option ) throw std::runtime_error(std::string("Error: --generate cannot be used with ") + benchmark_option + ", it only writes a problem.");
+    if ( cube_depth && !is_cube ) throw std::runtime_error("Error: --cube-depth can only be used with --cube.");
+    if ( beam_width && !is_beam ) throw std::runtime_error("Error: --beam-width can only be used with --beam.");
+    if ( num_processes && !is_shm_bfs ) throw std::runtime_error("Error: --processes can only be used with --shm-bfs.");
+    if ( partition_capacity && !is_shm_bfs ) throw std::runtime_error("Error: --partition-capacity can only be used with --shm-bfs.");
+    if ( is_preprocess && !is_sat ) throw std::runtime_error("Error: --preprocess can only be used with --sat (problem files use the preprocess key).");
+    if ( is_contract && !is_maze ) throw std::runtime_error("Error: --contract can only be used with --maze (problem files use the contract key).");
+    if ( is_components && (is_maze || is_hanoi) ) throw std::runtime_error("Error: --components can only be used with SAT problems.");
+    if ( is_probsat && !is_walksat && !is_walksat_first ) throw std::runtime_error("Error: --probsat can only be used with --walksat or --walksat-first.");
+    if ( is_walksat_first && (is_maze || is_hanoi) ) throw std::runtime_error("Error: --walksat-first can only be used with SAT problems.");
+    if ( is_jps && (is_sat || is_hanoi) ) throw std::runtime_error("Error: --jps can only be used with mazes.");
+    if ( is_wavefront && (is_sat || is_hanoi) ) throw std::runtime_error("Error: --wavefront can only be used with mazes.");
+    if ( is_count && (is_maze || is_hanoi) ) throw std::runtime_error("Error: --count and --enumerate can only be used with SAT problems.");
+    if ( is_count && (algorithm_option || is_components) ) throw std::runtime_error("Error: --count and --enumerate replace the search algorithms and cannot be combined with them.");
+    if ( route_queries && (is_sat || is_hanoi) ) throw std::runtime_error("Error: --route-queries can only be used with mazes.");
+    if ( route_queries && (is_count || algorithm_option) ) throw std::runtime_error("Error: --route-queries replaces the search algorithms and cannot be combined with them.");
+    if ( replan_rounds && (is_sat || is_hanoi) ) throw std::runtime_error("Error: --replan can only be used with mazes.");
+    if ( replan_rounds && (route_queries || is_count || algorithm_option) ) throw std::runtime_error("Error: --replan replaces the search algorithms and cannot be combined with them or --route-queries.");
+    if ( hpa_cluster_size && !route_queries ) throw std::runtime_error("Error: --hpa can only be used with --route-queries.");
+    if ( max_weight != 1 && !is_maze ) throw std::runtime_error("Error: --max-weight can only be used with --maze.");
+    if ( (pdb_size || !pdb_directory.empty()) && !is_hanoi ) throw std::runtime_error("Error: --pdb and --pdb-dir can only be used with --hanoi (problem files use the pdb_size and pdb_dir keys).");
+    if ( !pdb_directory.empty() && !pdb_size ) throw std::runtime_error("Error: --pdb-dir needs --pdb.");
+    if ( !is_dist_bfs && (dist_rank != -1 || dist_size != 0 || !dist_endpoint.empty()) ) throw std::runtime_error("Error: --dist-rank, --dist-size and --dist-endpoint can only be used with --dist-bfs.");
+    if ( is_dist_bfs && (dist_size < 1 || dist_rank < 0 || dist_rank >= dist_size || dist_endpoint.empty()) ) throw std::runtime_error("Error: --dist-bfs needs --dist-size <n>, --dist-rank <0..n-1> and --dist-endpoint <endpoint>.");
     if ( (is_bfs && is_iddfs) || (is_parallel && is_sequential) ) throw std::runtime_error("Error: --bfs cannot be used with --iddfs, and --parallel cannot be used with --sequential.");
 }
 
@@ -159,6 +391,38 @@ void print_help () {
                 << "  -S, --sequential       Run only sequential algorithms\n"
                 << "  --bfs                  Run only BFS algorithms\n"
                 << "  --iddfs                Run only IDDFS algorithms\n"
+                << "  --ucs                  Run Uniform-Cost Search (bucket queue), finds the cheapest path in weighted mazes\n"
+                << "  --frontier-bfs         Run BFS that stores only the last three levels and rebuilds the path by divide and conquer\n"
+                << "  --jps                  Run jump point search with precomputed jumps on an unweighted maze (sequential only)\n"
+                << "  --wavefront            Run bit-parallel BFS on a maze, advancing each level with shifts and masks over packed rows\n"
+                << "  --walksat              Run WalkSAT local search on a SAT problem, fast on satisfiable instances but may give up\n"
+                << "  --walksat-first        Run WalkSAT before every selected algorithm, which only runs if no model is found\n"
+                << "  --probsat              Let --walksat and --walksat-first pick the flipped variable with the probSAT rule\n"
+                << "  --preprocess           Simplify the SAT problem (units, pure literals, subsumption) before searching\n"
+                << "  --cube                 Run cube and conquer on a SAT problem: lookahead splits it into cubes, workers steal cubes\n"
+                << "  --cube-depth <n>       Depth of the --cube split tree, up to 2^n cubes (default: 16 cubes per thread)\n"
+                << "  --gray-code            Try every assignment of a SAT problem in Gray-code order, one variable flip per step\n"
+                << "  --count                Count all models of the SAT problem instead of searching for one\n"
+                << "  --enumerate <file>     Count the models of the SAT problem and write them to <file>, one per line\n"
+                << "  --route-queries <n>    Answer n random path queries on the maze with a tree index instead of searching\n"
+                << "  --hpa <n>              Answer --route-queries with a hierarchy of n x n clusters, cached in <file>.hpa with -f\n"
+                << "  --replan <n>           Toggle a random maze cell n times, replanning incrementally (D* Lite) against fresh UCS\n"
+                << "  --components           Solve the independent components of the SAT problem separately (in parallel)\n"
+                << "  --beam                 Run beam search, keeps the best states of each level and reports if the path is optimal\n"
+                << "  --beam-width <n>       Maximum number of states --beam keeps per level (default: 1000)\n"
+                << "  --pdb <n>              Give the Hanoi problem an additive pattern database heuristic with n discs per pattern\n"
+                << "  --pdb-dir <dir>        Map the pattern databases from <dir>, building and saving missing ones\n"
+                << "  --max-weight <n>       Give the generated maze random cell weights from 1 to n (default: 1, unweighted)\n"
+                << "  --contract             Fill the dead ends of the maze and search its junction graph, corridors become single moves\n"
+                << "  --portfolio            Race parallel BFS and IDDFS, report the first answer and the winning engine\n"
+                << "  --shm-bfs              Run BFS in worker processes sharing memory (Linux only)\n"
+                << "  --processes <n>        Number of --shm-bfs worker processes (default: one per NUMA node)\n"
+                << "  --partition-capacity <n> Maximum number of visited states per --shm-bfs worker (default: 1048576)\n"
+                << "  --dist-bfs             Run this process as one rank of a distributed BFS\n"
+                << "  --dist-rank <r>        Rank of this process (0 to size - 1)\n"
+                << "  --dist-size <n>        Number of processes of the distributed BFS\n"
+                << "  --dist-endpoint <e>    unix:<prefix>, tcp:<host>:<port> or tcp:<host:port>,... (one per rank)\n"
+                << "  --serve <socket>       Run as a solver daemon listening on a Unix domain socket\n"
                 << "  -H, --help             Print this help message\n" << std::endl;
 }
 
@@ -178,12 +442,16 @@ void generate_problem () {
         std::cin >> height;
         std::cout << "Enter seed: ";
         std::cin >> seed;
+        int weight;
+        std::cout << "Enter maximum cell weight (1 for an unweighted maze): ";
+        std::cin >> weight;
 
         problem_params["width"] = std::to_string(width);
         problem_params["height"] = std::to_string(height);
         problem_params["seed"] = std::to_string(seed);
+        if ( weight != 1 ) problem_params["max_weight"] = std::to_string(weight);
 
-        std::shared_ptr<generator> generator = std::make_shared<maze_generator>(width, height, seed);
+        std::shared_ptr<generator> generator = std::make_shared<maze_generator>(width, height, seed, weight);
         initial_state = generator->generate();
 
         const auto *maze = dynamic_cast<const maze_state*>(initial_state.get());
@@ -260,7 +528,7 @@ void generate_problem () {
         std::shared_ptr<generator> generator = std::make_shared<hanoi_generator>(num_pegs, num_discs);
         initial_state = generator->generate();
 
-        const auto *hanoi = dynamic_cast<const hanoi_state*>(initial_state.get());
+        const auto *hanoi = dynamic_cast<const hanoi_view*>(initial_state.get());
         if ( hanoi ) {
             hanoi->print_state();
         }
@@ -287,34 +555,234 @@ void benchmark_algorithms () {
         initial_state = problem_loader::load_problem(filename);
     } else {
         if ( is_maze ) {
-            std::shared_ptr<generator> generator = std::make_shared<maze_generator>(69, 69, 8);
+            std::shared_ptr<generator> generator = std::make_shared<maze_generator>(69, 69, 8, max_weight, is_contract);
             initial_state = generator->generate();
         } else if ( is_sat ) {
-            std::shared_ptr<generator> generator = std::make_shared<sat_generator>(14, 9, 4, 1);
+            std::shared_ptr<generator> generator = std::make_shared<sat_generator>(14, 9, 4, 1, is_preprocess);
             initial_state = generator->generate();
         } else if ( is_hanoi ) {
-            std::shared_ptr<generator> generator = std::make_shared<hanoi_generator>(3, 4);
+            std::shared_ptr<const hanoi_heuristic> heuristic = pdb_size ? hanoi_heuristic::create(3, 4, pdb_size, pdb_directory) : nullptr;
+            std::shared_ptr<generator> generator = std::make_shared<hanoi_generator>(3, 4, true, heuristic);
             initial_state = generator->generate();
         }
     }
 
-    int algorithm_mask = 0;
-    if ( is_parallel ) {
-        if ( is_bfs ) algorithm_mask |= (2);
-        else if ( is_iddfs ) algorithm_mask |= (8);
-        else algorithm_mask |= (2 | 8);
-    } else if ( is_sequential ) {
-        if ( is_bfs ) algorithm_mask |= (1);
-        else if ( is_iddfs ) algorithm_mask |= (4);
-        else algorithm_mask |= (1 | 4);
-    } else if ( is_bfs ) {
-        algorithm_mask |= (1 | 2);
-    } else if ( is_iddfs ) {
-        algorithm_mask |= (4 | 8);
-    } else {
-        algorithm_mask |= (1 | 2 | 4 | 8);
+    if ( is_count ) {
+        count_models(initial_state);
+        return;
+    }
+    if ( route_queries ) {
+        answer_route_queries(initial_state);
+        return;
+    }
+    if ( replan_rounds ) {
+        replan_changing_maze(initial_state);
+        return;
+    }
+
+    // Select the algorithms, BFS and IDDFS run when no algorithm is given
+    unsigned long long algorithm_mask = 0;
+    if ( is_bfs ) algorithm_mask |= algorithm_bit(algorithm_type::BFS_SEQ) | algorithm_bit(algorithm_type::BFS_PAR);
+    if ( is_iddfs ) algorithm_mask |= algorithm_bit(algorithm_type::IDDFS_SEQ) | algorithm_bit(algorithm_type::IDDFS_PAR);
+    if ( is_portfolio ) algorithm_mask |= algorithm_bit(algorithm_type::PORTFOLIO);
+    if ( is_shm_bfs ) algorithm_mask |= algorithm_bit(algorithm_type::BFS_SHM);
+    if ( is_dist_bfs ) algorithm_mask |= algorithm_bit(algorithm_type::BFS_DIST);
+    if ( is_ucs ) algorithm_mask |= algorithm_bit(algorithm_type::UCS_SEQ) | algorithm_bit(algorithm_type::UCS_PAR);
+    if ( is_frontier_bfs ) algorithm_mask |= algorithm_bit(algorithm_type::FRONTIER_SEQ) | algorithm_bit(algorithm_type::FRONTIER_PAR);
+    if ( is_beam ) algorithm_mask |= algorithm_bit(algorithm_type::BEAM_SEQ) | algorithm_bit(algorithm_type::BEAM_PAR);
+    if ( is_cube ) algorithm_mask |= algorithm_bit(algorithm_type::CUBE_SEQ) | algorithm_bit(algorithm_type::CUBE_PAR);
+    if ( is_walksat ) algorithm_mask |= algorithm_bit(algorithm_type::WALKSAT_SEQ) | algorithm_bit(algorithm_type::WALKSAT_PAR);
+    if ( is_gray_code ) algorithm_mask |= algorithm_bit(algorithm_type::GRAY_SEQ) | algorithm_bit(algorithm_type::GRAY_PAR);
+    if ( is_jps ) algorithm_mask |= algorithm_bit(algorithm_type::JPS);
+    if ( is_wavefront ) algorithm_mask |= algorithm_bit(algorithm_type::WAVE_SEQ) | algorithm_bit(algorithm_type::WAVE_PAR);
+    if ( algorithm_mask == 0 ) {
+        algorithm_mask = algorithm_bit(algorithm_type::BFS_SEQ) | algorithm_bit(algorithm_type::BFS_PAR)
+                       | algorithm_bit(algorithm_type::IDDFS_SEQ) | algorithm_bit(algorithm_type::IDDFS_PAR);
     }
 
-    algorithm_benchmark benchmarker(initial_state, algorithm_mask);
+    // Keep only the parallel or sequential variants if requested
+    if ( is_parallel || is_sequential ) {
+        for ( int bit = 0; bit < 64; ++bit ) {
+            if ( is_parallel_algorithm(static_cast<algorithm_type>(bit)) != is_parallel ) algorithm_mask &= ~(1ULL << bit);
+        }
+    }
+    if ( algorithm_mask == 0 ) throw std::runtime_error("Error: The selected algorithms have no " + std::string(is_parallel ? "parallel" : "sequential") + " variant.");
+
+    solve_options options;
+    options.num_processes = num_processes;
+    if ( partition_capacity ) options.partition_capacity = partition_capacity;
+    options.dist_rank = dist_rank;
+    options.dist_size = dist_size;
+    options.dist_endpoint = dist_endpoint;
+    if ( beam_width ) options.beam_width = beam_width;
+    options.local_search_first = is_walksat_first;
+    options.use_probsat = is_probsat;
+    options.decompose_components = is_components;
+    if ( cube_depth ) options.cube_depth = cube_depth;
+
+    algorithm_benchmark benchmarker(initial_state, algorithm_mask, options);
     benchmarker.solve();
-}
\ No newline at end of file
+}
+
+void count_models ( const state_pointer &initial_state ) {
+    model_counter counter(initial_state);
+
+    std::ofstream models;
+    if ( !models_filename.empty() ) {
+        models.open(models_filename);
+        if ( !models ) throw std::runtime_error("Error: Could not open " + models_filename + " for writing.");
+    }
+
+    for ( bool parallel : { false, true } ) {
+        if ( (parallel && is_sequential) || (!parallel && is_parallel) ) continue;
+        if ( !parallel && models.is_open() && !is_sequential ) continue;
+
+        std::string name = parallel ? "Model counting (parallel)" : "Model counting (sequential)";
+        std::cout << "Running " << name << "..." << std::endl;
+        auto start = std::chrono::steady_clock::now();
+        model_count count = models.is_open() ? counter.enumerate(models, parallel) : counter.count(parallel);
+        std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+        std::cout << name << ": " << count.to_string() << " models in " << duration.count() << " seconds"
+                  << ", expanded states: " << counter.get_expanded_states() << ".\n";
+        if ( models.is_open() ) std::cout << "    Models written to " << models_filename << "\n";
+    }
+}
+
+void answer_route_queries ( const state_pointer &initial_state ) {
+    std::shared_ptr<const maze_state::grid_layout> grid;
+    std::pair<int, int> start;
+    if ( const auto *maze = dynamic_cast<const maze_state*>(initial_state.get()) ) {
+        grid = maze->get_grid();
+        start = maze->get_position();
+    } else if ( const auto *junction = dynamic_cast<const maze_junction_state*>(initial_state.get()) ) {
+        grid = junction->get_graph()->grid;
+        start = junction->get_position();
+    } else throw std::runtime_error("Error: --route-queries can only be used with mazes.");
+
+    // The tree index needs a maze without loops, the hierarchy works on any maze and is cached next to a maze file
+    std::unique_ptr<maze_tree_index> index;
+    std::shared_ptr<const maze_hierarchy> hierarchy;
+    auto build_start = std::chrono::steady_clock::now();
+    if ( hpa_cluster_size ) {
+        hierarchy = maze_hierarchy::create(grid, hpa_cluster_size, is_file ? filename + ".hpa" : "");
+        std::chrono::duration<double> build_duration = std::chrono::steady_clock::now() - build_start;
+        std::cout << "Route hierarchy: " << hierarchy->get_num_nodes() << " nodes and " << hierarchy->get_num_edges() << " edges ("
+                  << hpa_cluster_size << "x" << hpa_cluster_size << " clusters) ready in " << build_duration.count() << " seconds"
+                  << ( is_file ? ", cached in " + filename + ".hpa" : "" ) << ".\n";
+    } else {
+        index = std::make_unique<maze_tree_index>(grid);
+        std::chrono::duration<double> build_duration = std::chrono::steady_clock::now() - build_start;
+        std::cout << "Route index: " << index->get_num_cells() << " cells indexed in " << build_duration.count() << " seconds.\n";
+    }
+
+    // Returns the distance and the cost between two cells, the hierarchy refines the whole path
+    auto query = [&index, &hierarchy]( std::pair<int, int> from, std::pair<int, int> to ) -> std::pair<unsigned long long, unsigned long long> {
+        if ( index ) return { index->get_distance(from, to), index->get_cost(from, to) };
+        state_pointer path = hierarchy->find_path(from, to);
+        if ( !path ) throw std::runtime_error("Error: The maze has no path between two of its cells.");
+        unsigned long long distance = 0, cost = 0;
+        for ( const state *current = path.get(); current->get_predecessor(); current = current->get_predecessor().get() ) {
+            ++distance;
+            cost += current->get_step_cost();
+        }
+        return { distance, cost };
+    };
+
+    std::vector<std::pair<int, int>> open_cells;
+    for ( int row = 0; row < grid->rows; ++row ) {
+        for ( int column = 0; column < grid->columns; ++column ) {
+            if ( grid->cells[row * grid->columns + column] != maze_state::WALL ) open_cells.emplace_back(row, column);
+        }
+    }
+    std::mt19937 random_engine(1);
+    std::uniform_int_distribution<std::size_t> dist_cell(0, open_cells.size() - 1);
+    std::vector<std::pair<std::size_t, std::size_t>> queries(route_queries);
+    for ( auto &[from, to] : queries ) {
+        from = dist_cell(random_engine);
+        to = dist_cell(random_engine);
+    }
+
+    unsigned long long total_distance = 0, total_cost = 0;
+    auto query_start = std::chrono::steady_clock::now();
+    for ( const auto &[from, to] : queries ) {
+        auto [distance, cost] = query(open_cells[from], open_cells[to]);
+        total_distance += distance;
+        total_cost += cost;
+    }
+    std::chrono::duration<double> query_duration = std::chrono::steady_clock::now() - query_start;
+    std::cout << "Route queries: " << route_queries << " answered in " << query_duration.count() << " seconds ("
+              << query_duration.count() * 1e6 / route_queries << " microseconds each), mean distance "
+              << static_cast<double>(total_distance) / route_queries << ", mean cost "
+              << static_cast<double>(total_cost) / route_queries << ".\n";
+
+    // The goal query must agree with a search on the plain maze
+    std::pair<int, int> goal { grid->goal_row, grid->goal_column };
+    if ( goal.first < 0 ) {
+        auto cell = std::find(grid->cells.begin(), grid->cells.end(), maze_state::GOAL);
+        if ( cell == grid->cells.end() ) throw std::runtime_error("Error: The maze has no goal.");
+        auto offset = static_cast<int>(cell - grid->cells.begin());
+        goal = { offset / grid->columns, offset % grid->columns };
+    }
+    solve_options options;
+    options.algorithm = algorithm_type::UCS_SEQ;
+    solve_result result = search_api::solve(std::make_shared<const maze_state>(nullptr, grid, start), options);
+    auto [distance, cost] = query(start, goal);
+    std::cout << "Start to goal: distance " << distance << ", cost " << cost << " (UCS: path length " << result.stats.path_length
+              << ", cost " << result.stats.path_cost << " in " << result.stats.duration.count() << " seconds).\n";
+}
+
+void replan_changing_maze ( const state_pointer &initial_state ) {
+    std::shared_ptr<const maze_state::grid_layout> grid;
+    std::pair<int, int> start;
+    if ( const auto *maze = dynamic_cast<const maze_state*>(initial_state.get()) ) {
+        grid = maze->get_grid();
+        start = maze->get_position();
+    } else if ( const auto *junction = dynamic_cast<const maze_junction_state*>(initial_state.get()) ) {
+        grid = junction->get_graph()->grid;
+        start = junction->get_position();
+    } else throw std::runtime_error("Error: --replan can only be used with mazes.");
+
+    maze_replanner replanner(grid, start);
+    auto plan_start = std::chrono::steady_clock::now();
+    unsigned long long cost = replanner.get_cost();
+    std::chrono::duration<double> plan_duration = std::chrono::steady_clock::now() - plan_start;
+    std::cout << "First plan: cost " << ( cost == state::UNREACHABLE ? "unreachable" : std::to_string(cost) ) << ", "
+              << replanner.get_expanded_states() << " expanded states in " << plan_duration.count() << " seconds.\n";
+
+    // The fresh searches run on a copy edited alongside the replanner
+    auto edited = std::make_shared<maze_state::grid_layout>(*grid);
+    std::mt19937 random_engine(1);
+    std::uniform_int_distribution<std::size_t> dist_cell(0, edited->cells.size() - 1);
+    std::size_t start_cell = static_cast<std::size_t>(start.first) * edited->columns + start.second;
+
+    std::chrono::duration<double> replan_duration { 0 }, search_duration { 0 };
+    unsigned long long replan_expanded = 0, search_expanded = 0;
+    for ( int round = 0; round < replan_rounds; ++round ) {
+        std::size_t cell;
+        do cell = dist_cell(random_engine);
+        while ( cell == start_cell || edited->cells[cell] == maze_state::GOAL );
+        auto type = edited->cells[cell] == maze_state::WALL ? maze_state::PATH : maze_state::WALL;
+        auto weight = static_cast<std::uint8_t>(edited->get_weight(static_cast<std::uint32_t>(cell)));
+        edited->cells[cell] = type;
+
+        auto replan_start = std::chrono::steady_clock::now();
+        replanner.set_cell({ static_cast<int>(cell) / edited->columns, static_cast<int>(cell) % edited->columns }, type, weight);
+        cost = replanner.get_cost();
+        replan_duration += std::chrono::steady_clock::now() - replan_start;
+        replan_expanded += replanner.get_expanded_states();
+
+        solve_options options;
+        options.algorithm = algorithm_type::UCS_SEQ;
+        solve_result result = search_api::solve(std::make_shared<const maze_state>(nullptr, edited, start), options);
+        search_duration += result.stats.duration;
+        search_expanded += result.stats.expanded_states;
+        if ( cost != ( result.found_solution ? result.stats.path_cost : state::UNREACHABLE ) ) {
+            throw std::runtime_error("Error: The replanned cost differs from UCS after round " + std::to_string(round + 1) + ".");
+        }
+    }
+    std::cout << "Replanning: " << replan_rounds << " edits replanned in " << replan_duration.count() << " seconds ("
+              << static_cast<double>(replan_expanded) / replan_rounds << " expanded states each), UCS from scratch took "
+              << search_duration.count() << " seconds (" << static_cast<double>(search_expanded) / replan_rounds
+              << " expanded states each), all costs agree.\n";
+}
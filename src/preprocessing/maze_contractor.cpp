@@ -0,0 +1,178 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "maze_contractor.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief Junction index of the cells that are not junctions.
+     */
+    constexpr std::uint32_t NO_JUNCTION = ~std::uint32_t(0);
+
+    /**
+     * @brief Returns the open neighbours of a cell in the order of `maze_state::get_descendents`.
+     */
+    std::vector<std::uint32_t> get_neighbours ( const maze_state::grid_layout &grid, const std::vector<bool> &open, std::uint32_t cell ) {
+        std::vector<std::uint32_t> neighbours;
+        grid.for_each_neighbour(cell, [&open, &neighbours]( std::uint32_t next ) {
+            if ( open[next] ) neighbours.push_back(next);
+        });
+        return neighbours;
+    }
+}
+
+// Junction state implementation
+std::vector<state_pointer> maze_junction_state::get_descendents () const {
+    return collect_successors();
+}
+
+successor_stream maze_junction_state::get_successors () const {
+    for ( std::uint32_t i = graph->edge_starts[junction]; i < graph->edge_starts[junction + 1]; ++i ) {
+        co_yield std::make_shared<const maze_junction_state>(shared_from_this(), graph, graph->edge_targets[i], i);
+    }
+}
+
+bool maze_junction_state::is_goal () const {
+    return graph->grid->cells[graph->cells[junction]] == maze_state::GOAL;
+}
+
+unsigned long long maze_junction_state::get_identifier () const {
+    return junction;
+}
+
+unsigned int maze_junction_state::get_step_cost () const {
+    return edge == NO_EDGE ? 1 : graph->edge_costs[edge];
+}
+
+std::string maze_junction_state::encode () const {
+    std::string data(2 * sizeof(std::uint32_t), '\0');
+    std::uint32_t fields[2] = { junction, edge };
+    std::memcpy(data.data(), fields, data.size());
+    return data;
+}
+
+state_pointer maze_junction_state::decode ( const std::string &data, const state_pointer predecessor ) const {
+    std::uint32_t fields[2];
+    if ( data.size() != sizeof(fields) ) throw std::invalid_argument("Invalid junction state encoding.");
+    std::memcpy(fields, data.data(), sizeof(fields));
+    if ( fields[0] >= graph->cells.size() || ( fields[1] != NO_EDGE && fields[1] >= graph->edge_targets.size() ) ) throw std::invalid_argument("Invalid junction state encoding.");
+    return std::make_shared<const maze_junction_state>(predecessor, graph, fields[0], fields[1]);
+}
+
+state_pointer maze_junction_state::expand () const {
+    // Collect the junctions back to the initial state, then walk their corridors forward
+    std::vector<const maze_junction_state*> junctions;
+    for ( const maze_junction_state *current = this; current != nullptr; current = dynamic_cast<const maze_junction_state*>(current->get_predecessor().get()) ) {
+        junctions.push_back(current);
+    }
+
+    const maze_state::grid_layout &grid = *graph->grid;
+    auto make_cell = [&grid, this]( const state_pointer &predecessor, std::uint32_t cell ) -> state_pointer {
+        return std::make_shared<const maze_state>(predecessor, graph->grid, std::make_pair(static_cast<int>(cell) / grid.columns, static_cast<int>(cell) % grid.columns));
+    };
+
+    state_pointer path = nullptr;
+    for ( auto it = junctions.rbegin(); it != junctions.rend(); ++it ) {
+        std::uint32_t junction_edge = ( *it )->edge;
+        if ( junction_edge != NO_EDGE ) {
+            for ( std::uint32_t i = graph->corridor_starts[junction_edge]; i < graph->corridor_starts[junction_edge + 1]; ++i ) path = make_cell(path, graph->corridor_cells[i]);
+        }
+        path = make_cell(path, graph->cells[( *it )->junction]);
+    }
+    return path;
+}
+
+const std::shared_ptr<const junction_graph> &maze_junction_state::get_graph () const {
+    return graph;
+}
+
+std::pair<int, int> maze_junction_state::get_position () const {
+    int columns = graph->grid->columns;
+    return { static_cast<int>(graph->cells[junction]) / columns, static_cast<int>(graph->cells[junction]) % columns };
+}
+
+
+// Contractor implementation
+state_pointer maze_contractor::contract ( const maze_state &initial_state ) {
+    const auto &layout = initial_state.get_grid();
+    const maze_state::grid_layout &grid = *layout;
+    auto [start_row, start_column] = initial_state.get_position();
+    auto start = static_cast<std::uint32_t>(start_row * grid.columns + start_column);
+    std::size_t num_cells = grid.cells.size();
+
+    auto graph = std::make_shared<junction_graph>();
+    graph->grid = layout;
+
+    std::vector<bool> open(num_cells);
+    std::vector<bool> kept(num_cells);
+    for ( std::size_t cell = 0; cell < num_cells; ++cell ) {
+        open[cell] = grid.cells[cell] != maze_state::WALL;
+        kept[cell] = cell == start || grid.cells[cell] == maze_state::GOAL;
+    }
+
+    // Fill the dead ends, filling a cell can turn its neighbour into a dead end
+    std::vector<std::uint8_t> degree(num_cells, 0);
+    std::vector<std::uint32_t> dead_ends;
+    for ( std::uint32_t cell = 0; cell < num_cells; ++cell ) {
+        if ( !open[cell] ) continue;
+        degree[cell] = static_cast<std::uint8_t>(get_neighbours(grid, open, cell).size());
+        if ( degree[cell] <= 1 && !kept[cell] ) dead_ends.push_back(cell);
+    }
+    while ( !dead_ends.empty() ) {
+        std::uint32_t cell = dead_ends.back();
+        dead_ends.pop_back();
+        if ( !open[cell] ) continue;
+        open[cell] = false;
+        ++graph->filled_cells;
+        for ( std::uint32_t neighbour : get_neighbours(grid, open, cell) ) {
+            if ( --degree[neighbour] == 1 && !kept[neighbour] ) dead_ends.push_back(neighbour);
+        }
+    }
+
+    // The remaining cells without exactly two neighbours become junctions, the start first
+    std::vector<std::uint32_t> junction_of(num_cells, NO_JUNCTION);
+    junction_of[start] = 0;
+    graph->cells.push_back(start);
+    for ( std::uint32_t cell = 0; cell < num_cells; ++cell ) {
+        if ( open[cell] && junction_of[cell] == NO_JUNCTION && ( degree[cell] != 2 || kept[cell] ) ) {
+            junction_of[cell] = static_cast<std::uint32_t>(graph->cells.size());
+            graph->cells.push_back(cell);
+        }
+    }
+
+    // Walk every corridor from both of its ends
+    graph->edge_starts.push_back(0);
+    graph->corridor_starts.push_back(0);
+    for ( std::uint32_t cell : graph->cells ) {
+        for ( std::uint32_t next : get_neighbours(grid, open, cell) ) {
+            std::uint32_t previous = cell;
+            unsigned int cost = 0;
+            std::size_t corridor_start = graph->corridor_cells.size();
+            while ( junction_of[next] == NO_JUNCTION ) {
+                graph->corridor_cells.push_back(next);
+                cost += grid.get_weight(next);
+                std::vector<std::uint32_t> neighbours = get_neighbours(grid, open, next);
+                std::uint32_t following = neighbours[0] == previous ? neighbours[1] : neighbours[0];
+                previous = next;
+                next = following;
+            }
+
+            // A corridor leading back to its own junction never shortens a path
+            if ( next == cell ) {
+                graph->corridor_cells.resize(corridor_start);
+                continue;
+            }
+            graph->edge_targets.push_back(junction_of[next]);
+            graph->edge_costs.push_back(cost + grid.get_weight(next));
+            graph->corridor_starts.push_back(static_cast<std::uint32_t>(graph->corridor_cells.size()));
+        }
+        graph->edge_starts.push_back(static_cast<std::uint32_t>(graph->edge_targets.size()));
+    }
+
+    std::uint32_t start_junction = graph->start;
+    return std::make_shared<const maze_junction_state>(nullptr, std::move(graph), start_junction);
+}
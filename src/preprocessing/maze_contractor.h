@@ -0,0 +1,170 @@
+/**
+ * @file maze_contractor.h
+ * @brief Declares the maze_contractor class, which turns a maze into a compact graph of junctions.
+ *
+ * This header file defines the `junction_graph` struct, the `maze_junction_state` class searching it and the
+ * `maze_contractor` class building it. Dead ends are filled first (they never lie on a path between the start and
+ * the goal), then every corridor of the remaining cells is contracted into one weighted edge between the junctions
+ * at its ends. The search visits the junctions only, and `maze_junction_state::expand` maps the result back to the
+ * cells of the maze.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef MAZE_CONTRACTOR_H
+#define MAZE_CONTRACTOR_H
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../generators/maze_generator.h"
+
+
+/**
+ * @brief The junctions of a maze and the corridors connecting them.
+ *
+ * A junction is a cell left after dead-end filling that does not have exactly two open neighbours, or the start or
+ * a goal cell. Edges are directed and stored per junction in the order of `maze_state::get_descendents`; every
+ * corridor gives one edge in each direction.
+ */
+struct junction_graph {
+    std::shared_ptr<const maze_state::grid_layout> grid; ///< The original maze.
+    std::vector<std::uint32_t> cells; ///< The cell of every junction (row-major index).
+    std::vector<std::uint32_t> edge_starts; ///< Offset of the edges of every junction, plus the end offset.
+    std::vector<std::uint32_t> edge_targets; ///< The junction every edge leads to.
+    std::vector<unsigned int> edge_costs; ///< The sum of the weights of the cells every edge enters, its target included.
+    std::vector<std::uint32_t> corridor_starts; ///< Offset of the inner cells of every edge in `corridor_cells`, plus the end offset.
+    std::vector<std::uint32_t> corridor_cells; ///< The cells between the ends of every edge, in walking order.
+    std::uint32_t start = 0; ///< The junction of the start position.
+    std::size_t filled_cells = 0; ///< The number of open cells removed by dead-end filling.
+};
+
+
+/**
+ * @brief Represents a junction of a contracted maze.
+ *
+ * A move follows a whole corridor. Its step cost is the cost of entering all cells of the corridor, so cost-aware
+ * searches find the cheapest path through the cells, while the path length counts junctions. The state keeps the
+ * edge it was reached by, `expand` uses it to rebuild the path through the cells.
+ */
+class maze_junction_state : public state, public std::enable_shared_from_this<maze_junction_state> {
+public:
+    /**
+     * @brief Edge of a state that was not reached by a move (the initial state).
+     */
+    static constexpr std::uint32_t NO_EDGE = ~std::uint32_t(0);
+
+    /**
+     * @brief Constructor for the maze_junction_state class.
+     *
+     * @param predecessor A pointer to the predecessor state.
+     * @param graph The junction graph.
+     * @param junction The current junction.
+     * @param edge The edge leading to the junction, `NO_EDGE` for the initial state.
+     */
+    maze_junction_state ( const state_pointer predecessor, std::shared_ptr<const junction_graph> graph, std::uint32_t junction, std::uint32_t edge = NO_EDGE )
+        : state( predecessor ), graph( std::move(graph) ), junction( junction ), edge( edge ) {}
+
+    /**
+     * @brief Generates the junctions at the other ends of the corridors of the current junction.
+     *
+     * @return A vector of state_pointers representing the successor states.
+     */
+    std::vector<state_pointer> get_descendents () const override;
+
+    /**
+     * @brief Yields the successor states one at a time.
+     *
+     * @return A stream of the successor states.
+     */
+    successor_stream get_successors () const override;
+
+    /**
+     * @brief Checks if the current junction is a goal cell.
+     *
+     * @return True if the junction is a goal, false otherwise.
+     */
+    bool is_goal () const override;
+
+    /**
+     * @brief Returns the index of the current junction.
+     *
+     * @return An unsigned long long representing the unique identifier.
+     */
+    unsigned long long get_identifier () const override;
+
+    /**
+     * @brief Returns the cost of the corridor leading to the current junction.
+     *
+     * @return The sum of the weights of the corridor cells and the junction, 1 for the initial state.
+     */
+    unsigned int get_step_cost () const override;
+
+    /**
+     * @brief Encodes the current state into a byte string.
+     *
+     * @return The junction and the edge as two 32-bit integers.
+     */
+    std::string encode () const override;
+
+    /**
+     * @brief Rebuilds a state of the same graph from its encoding.
+     *
+     * @param data A state encoded by `encode`.
+     * @param predecessor The predecessor of the rebuilt state.
+     * @return A shared pointer to the rebuilt state.
+     */
+    state_pointer decode ( const std::string &data, const state_pointer predecessor ) const override;
+
+    /**
+     * @brief Maps the path leading to the current junction back to the cells of the maze.
+     *
+     * @return The `maze_state` of the junction cell, its predecessors walk every cell back to the start.
+     */
+    state_pointer expand () const;
+
+    /**
+     * @brief Returns the junction graph.
+     *
+     * @return A pointer to the graph.
+     */
+    const std::shared_ptr<const junction_graph> &get_graph () const;
+
+    /**
+     * @brief Returns the (row, column) position of the current junction.
+     *
+     * @return The position in the maze.
+     */
+    std::pair<int, int> get_position () const;
+
+private:
+    std::shared_ptr<const junction_graph> graph; ///< The junction graph, shared by all states of the maze.
+    std::uint32_t junction; ///< The current junction.
+    std::uint32_t edge; ///< The edge leading to the junction, `NO_EDGE` for the initial state.
+};
+
+
+/**
+ * @brief Builds junction graphs from mazes.
+ */
+class maze_contractor {
+public:
+    /**
+     * @brief Fills the dead ends of a maze and contracts its corridors.
+     *
+     * Open cells with at most one open neighbour are removed repeatedly unless they are the start or a goal, which
+     * leaves only the cells lying on paths between them (in a perfect maze, the single path from the start to the
+     * goal). The remaining cells without exactly two neighbours become junctions, and the corridors between them
+     * edges.
+     *
+     * @param initial_state The initial state of the maze, its position is the start.
+     * @return The junction of the start position.
+     */
+    static state_pointer contract ( const maze_state &initial_state );
+};
+
+#endif //MAZE_CONTRACTOR_H
@@ -0,0 +1,434 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "maze_hierarchy.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+namespace {
+    /**
+     * @brief Node of the cells that are not on a cluster border.
+     */
+    constexpr std::uint32_t NO_NODE = ~std::uint32_t(0);
+
+    /**
+     * @brief Header of a saved hierarchy, followed by the nodes, edge offsets, edge targets and edge costs.
+     */
+    struct file_header {
+        char magic[8]; ///< "MAZE_HPA".
+        std::uint32_t version; ///< `FILE_VERSION`.
+        std::uint32_t rows; ///< The number of rows of the maze.
+        std::uint32_t columns; ///< The number of columns of the maze.
+        std::uint32_t cluster_size; ///< The width and height of a cluster.
+        std::uint64_t num_nodes; ///< The number of nodes.
+        std::uint64_t num_edges; ///< The number of edges.
+        std::uint64_t fingerprint; ///< The fingerprint of the maze (`get_fingerprint`).
+    };
+
+    constexpr char FILE_MAGIC[8] = { 'M', 'A', 'Z', 'E', '_', 'H', 'P', 'A' };
+    constexpr std::uint32_t FILE_VERSION = 1;
+
+    /**
+     * @brief Hashes the size, cells and weights of a maze (64-bit FNV-1a), a saved hierarchy belongs to the maze with its fingerprint.
+     */
+    std::uint64_t get_fingerprint ( const maze_state::grid_layout &grid ) {
+        std::uint64_t hash = 0xcbf29ce484222325ULL;
+        auto mix = [&hash]( std::uint64_t value ) {
+            hash ^= value;
+            hash *= 0x100000001b3ULL;
+        };
+        mix(static_cast<std::uint64_t>(grid.rows));
+        mix(static_cast<std::uint64_t>(grid.columns));
+        for ( maze_state::cell_type cell : grid.cells ) mix(static_cast<std::uint64_t>(cell));
+        mix(grid.weights.size());
+        for ( std::uint8_t weight : grid.weights ) mix(weight);
+        return hash;
+    }
+
+    /**
+     * @brief Dijkstra's algorithm restricted to the cells of one cluster.
+     *
+     * A forward search finds the cheapest paths from the source to the cells of the cluster, a reverse one the
+     * cheapest paths from the cells to the source.
+     */
+    class local_search {
+    public:
+        local_search ( const maze_state::grid_layout &grid, int first_row, int first_column, int cluster_size, std::uint32_t source, bool reverse )
+            : grid( grid ), first_row( first_row ), first_column( first_column ), reverse( reverse ) {
+            rows = std::min(cluster_size, grid.rows - first_row);
+            columns = std::min(cluster_size, grid.columns - first_column);
+            costs.assign(static_cast<std::size_t>(rows) * columns, state::UNREACHABLE);
+            parents.assign(costs.size(), NO_NODE);
+
+            using entry = std::pair<unsigned long long, std::uint32_t>;
+            std::priority_queue<entry, std::vector<entry>, std::greater<>> queue;
+            costs[get_local(source)] = 0;
+            queue.emplace(0, get_local(source));
+            while ( !queue.empty() ) {
+                auto [cost, local] = queue.top();
+                queue.pop();
+                if ( cost > costs[local] ) continue;
+
+                std::uint32_t cell = get_cell(local);
+                grid.for_each_neighbour(cell, [&, cost = cost, local = local]( std::uint32_t next_cell ) {
+                    if ( !contains(next_cell) || grid.cells[next_cell] == maze_state::WALL ) return;
+
+                    // A forward move enters the next cell, a reverse one leaves it for the current cell
+                    std::uint32_t next = get_local(next_cell);
+                    unsigned long long next_cost = cost + grid.get_weight(reverse ? cell : next_cell);
+                    if ( next_cost < costs[next] ) {
+                        costs[next] = next_cost;
+                        parents[next] = local;
+                        queue.emplace(next_cost, next);
+                    }
+                });
+            }
+        }
+
+        /**
+         * @brief Returns the cost between the source and a cell of the cluster, `state::UNREACHABLE` if there is no path.
+         */
+        [[nodiscard]] unsigned long long get_cost ( std::uint32_t cell ) const {
+            return costs[get_local(cell)];
+        }
+
+        /**
+         * @brief Appends the cells of the path between the source and a reachable cell, in walking order.
+         */
+        void append_path ( std::uint32_t cell, std::vector<std::uint32_t> &path ) const {
+            std::size_t begin = path.size();
+            for ( std::uint32_t local = get_local(cell); local != NO_NODE; local = parents[local] ) path.push_back(get_cell(local));
+            if ( !reverse ) std::reverse(path.begin() + static_cast<std::ptrdiff_t>(begin), path.end());
+        }
+
+    private:
+        [[nodiscard]] bool contains ( std::uint32_t cell ) const {
+            int row = static_cast<int>(cell) / grid.columns - first_row;
+            int column = static_cast<int>(cell) % grid.columns - first_column;
+            return row >= 0 && row < rows && column >= 0 && column < columns;
+        }
+
+        [[nodiscard]] std::uint32_t get_local ( std::uint32_t cell ) const {
+            int row = static_cast<int>(cell) / grid.columns - first_row;
+            int column = static_cast<int>(cell) % grid.columns - first_column;
+            return static_cast<std::uint32_t>(row * columns + column);
+        }
+
+        [[nodiscard]] std::uint32_t get_cell ( std::uint32_t local ) const {
+            int row = first_row + static_cast<int>(local) / columns;
+            int column = first_column + static_cast<int>(local) % columns;
+            return static_cast<std::uint32_t>(row * grid.columns + column);
+        }
+
+        const maze_state::grid_layout &grid;
+        int first_row, first_column, rows = 0, columns = 0;
+        bool reverse;
+        std::vector<unsigned long long> costs;
+        std::vector<std::uint32_t> parents;
+    };
+}
+
+struct maze_hierarchy::route {
+    std::vector<std::uint32_t> nodes; ///< The abstract nodes from the start to the goal, empty if the path stays in one cluster.
+    unsigned long long cost = state::UNREACHABLE; ///< The cost of the path.
+    std::unique_ptr<local_search> start_search; ///< The forward search from the start in its cluster.
+    std::unique_ptr<local_search> goal_search; ///< The reverse search from the goal in its cluster.
+};
+
+maze_hierarchy::maze_hierarchy ( std::shared_ptr<const maze_state::grid_layout> grid, int cluster_size )
+    : grid( std::move(grid) ), cluster_size( cluster_size ) {
+    cluster_columns = ( this->grid->columns + cluster_size - 1 ) / cluster_size;
+}
+
+std::shared_ptr<const maze_hierarchy> maze_hierarchy::build ( std::shared_ptr<const maze_state::grid_layout> grid, int cluster_size ) {
+    if ( cluster_size < 1 || cluster_size > MAX_CLUSTER_SIZE ) throw std::invalid_argument("Cluster size must be between 1 and " + std::to_string(MAX_CLUSTER_SIZE) + ".");
+    std::shared_ptr<maze_hierarchy> hierarchy(new maze_hierarchy(std::move(grid), cluster_size));
+    const maze_state::grid_layout &layout = *hierarchy->grid;
+    int cluster_rows = ( layout.rows + cluster_size - 1 ) / cluster_size;
+    int num_clusters = cluster_rows * hierarchy->cluster_columns;
+
+    // Open cells with an open neighbour in another cluster become nodes, grouped by cluster
+    std::vector<std::uint32_t> node_of(layout.cells.size(), NO_NODE);
+    auto for_each_crossing = [&]( std::uint32_t cell, const auto &visit ) {
+        layout.for_each_neighbour(cell, [&]( std::uint32_t next ) {
+            if ( layout.cells[next] != maze_state::WALL && hierarchy->get_cluster(next) != hierarchy->get_cluster(cell) ) visit(next);
+        });
+    };
+    for ( int cluster = 0; cluster < num_clusters; ++cluster ) {
+        int first_row = cluster / hierarchy->cluster_columns * cluster_size;
+        int first_column = cluster % hierarchy->cluster_columns * cluster_size;
+        for ( int row = first_row; row < std::min(first_row + cluster_size, layout.rows); ++row ) {
+            for ( int column = first_column; column < std::min(first_column + cluster_size, layout.columns); ++column ) {
+                auto cell = static_cast<std::uint32_t>(row * layout.columns + column);
+                if ( layout.cells[cell] == maze_state::WALL ) continue;
+                bool crossing = false;
+                for_each_crossing(cell, [&crossing]( std::uint32_t ) { crossing = true; });
+                if ( crossing ) {
+                    node_of[cell] = static_cast<std::uint32_t>(hierarchy->nodes.size());
+                    hierarchy->nodes.push_back(cell);
+                }
+            }
+        }
+    }
+    hierarchy->index_clusters();
+
+    // Every cluster searches from each of its nodes, the clusters write the edges of disjoint nodes
+    std::vector<std::vector<std::pair<std::uint32_t, std::uint32_t>>> edges(hierarchy->nodes.size());
+    #pragma omp parallel for schedule(dynamic)
+    for ( int cluster = 0; cluster < num_clusters; ++cluster ) {
+        int first_row = cluster / hierarchy->cluster_columns * cluster_size;
+        int first_column = cluster % hierarchy->cluster_columns * cluster_size;
+        std::uint32_t begin = hierarchy->cluster_starts[cluster], end = hierarchy->cluster_starts[cluster + 1];
+        for ( std::uint32_t node = begin; node < end; ++node ) {
+            std::uint32_t cell = hierarchy->nodes[node];
+            for_each_crossing(cell, [&]( std::uint32_t next ) { edges[node].emplace_back(node_of[next], layout.get_weight(next)); });
+
+            local_search search(layout, first_row, first_column, cluster_size, cell, false);
+            for ( std::uint32_t other = begin; other < end; ++other ) {
+                unsigned long long cost = search.get_cost(hierarchy->nodes[other]);
+                if ( other != node && cost != state::UNREACHABLE ) edges[node].emplace_back(other, static_cast<std::uint32_t>(cost));
+            }
+        }
+    }
+
+    hierarchy->edge_starts.push_back(0);
+    for ( const auto &node_edges : edges ) {
+        for ( const auto &[target, cost] : node_edges ) {
+            hierarchy->edge_targets.push_back(target);
+            hierarchy->edge_costs.push_back(cost);
+        }
+        hierarchy->edge_starts.push_back(static_cast<std::uint32_t>(hierarchy->edge_targets.size()));
+    }
+    return hierarchy;
+}
+
+std::shared_ptr<const maze_hierarchy> maze_hierarchy::load ( const std::string &filename, std::shared_ptr<const maze_state::grid_layout> grid ) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if ( !file.is_open() ) throw std::runtime_error("Cannot open maze hierarchy: " + filename);
+    std::streamoff size = file.tellg();
+    file.seekg(0);
+    if ( size < static_cast<std::streamoff>(sizeof(file_header)) ) throw std::runtime_error("Corrupted maze hierarchy: " + filename);
+
+    file_header header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if ( std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || header.version != FILE_VERSION ) throw std::runtime_error("Not a maze hierarchy: " + filename);
+    if ( header.rows != static_cast<std::uint32_t>(grid->rows) || header.columns != static_cast<std::uint32_t>(grid->columns) || header.fingerprint != get_fingerprint(*grid) ) return nullptr;
+
+    std::uint64_t payload = ( header.num_nodes * 2 + 1 + header.num_edges * 2 ) * sizeof(std::uint32_t);
+    if ( header.cluster_size < 1 || header.cluster_size > MAX_CLUSTER_SIZE || header.num_nodes > grid->cells.size()
+         || static_cast<std::uint64_t>(size) - sizeof(header) != payload ) {
+        throw std::runtime_error("Corrupted maze hierarchy: " + filename);
+    }
+
+    std::shared_ptr<maze_hierarchy> hierarchy(new maze_hierarchy(std::move(grid), static_cast<int>(header.cluster_size)));
+    auto read = [&file]( std::vector<std::uint32_t> &values, std::uint64_t count ) {
+        values.resize(count);
+        file.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(count * sizeof(std::uint32_t)));
+    };
+    read(hierarchy->nodes, header.num_nodes);
+    read(hierarchy->edge_starts, header.num_nodes + 1);
+    read(hierarchy->edge_targets, header.num_edges);
+    read(hierarchy->edge_costs, header.num_edges);
+    if ( !file ) throw std::runtime_error("Cannot read maze hierarchy: " + filename);
+
+    // The offsets and indices are trusted by the queries, so they are checked once here
+    const maze_state::grid_layout &layout = *hierarchy->grid;
+    bool valid = hierarchy->edge_starts.front() == 0 && hierarchy->edge_starts.back() == header.num_edges
+                 && std::is_sorted(hierarchy->edge_starts.begin(), hierarchy->edge_starts.end())
+                 && std::all_of(hierarchy->edge_targets.begin(), hierarchy->edge_targets.end(), [&header]( std::uint32_t target ) { return target < header.num_nodes; });
+    for ( std::size_t node = 0; valid && node < hierarchy->nodes.size(); ++node ) {
+        std::uint32_t cell = hierarchy->nodes[node];
+        valid = cell < layout.cells.size() && layout.cells[cell] != maze_state::WALL
+                && ( node == 0 || hierarchy->get_cluster(hierarchy->nodes[node - 1]) <= hierarchy->get_cluster(cell) );
+    }
+    if ( !valid ) throw std::runtime_error("Corrupted maze hierarchy: " + filename);
+
+    hierarchy->index_clusters();
+    return hierarchy;
+}
+
+std::shared_ptr<const maze_hierarchy> maze_hierarchy::create ( std::shared_ptr<const maze_state::grid_layout> grid, int cluster_size, const std::string &cache_filename ) {
+    if ( cache_filename.empty() ) return build(std::move(grid), cluster_size);
+
+    // A hierarchy of another maze or cluster size is stale and replaced
+    if ( std::filesystem::exists(cache_filename) ) {
+        auto hierarchy = load(cache_filename, grid);
+        if ( hierarchy && hierarchy->get_cluster_size() == cluster_size ) return hierarchy;
+    }
+    auto hierarchy = build(std::move(grid), cluster_size);
+    hierarchy->save(cache_filename);
+    return hierarchy;
+}
+
+void maze_hierarchy::save ( const std::string &filename ) const {
+    // Written under a temporary name and renamed, so a concurrent loader never reads a partial hierarchy
+    std::string temporary = filename + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if ( !file.is_open() ) throw std::runtime_error("Cannot write maze hierarchy: " + filename);
+
+        file_header header {};
+        std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+        header.version = FILE_VERSION;
+        header.rows = static_cast<std::uint32_t>(grid->rows);
+        header.columns = static_cast<std::uint32_t>(grid->columns);
+        header.cluster_size = static_cast<std::uint32_t>(cluster_size);
+        header.num_nodes = nodes.size();
+        header.num_edges = edge_targets.size();
+        header.fingerprint = get_fingerprint(*grid);
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for ( const auto *values : { &nodes, &edge_starts, &edge_targets, &edge_costs } ) {
+            file.write(reinterpret_cast<const char*>(values->data()), static_cast<std::streamsize>(values->size() * sizeof(std::uint32_t)));
+        }
+        if ( !file ) throw std::runtime_error("Cannot write maze hierarchy: " + filename);
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, filename, error);
+    if ( error ) throw std::runtime_error("Cannot write maze hierarchy: " + filename + ": " + error.message());
+}
+
+unsigned long long maze_hierarchy::get_cost ( std::pair<int, int> from, std::pair<int, int> to ) const {
+    return search(get_cell(from), get_cell(to)).cost;
+}
+
+state_pointer maze_hierarchy::find_path ( std::pair<int, int> from, std::pair<int, int> to ) const {
+    std::uint32_t start = get_cell(from), goal = get_cell(to);
+    route found = search(start, goal);
+    if ( found.cost == state::UNREACHABLE ) return nullptr;
+
+    // Refine the route: the searches of the start and goal clusters give the ends, every intra-cluster edge is searched again
+    std::vector<std::uint32_t> cells;
+    if ( found.nodes.empty() ) {
+        found.start_search->append_path(goal, cells);
+    } else {
+        found.start_search->append_path(nodes[found.nodes.front()], cells);
+        for ( std::size_t i = 1; i < found.nodes.size(); ++i ) {
+            std::uint32_t previous = nodes[found.nodes[i - 1]], next = nodes[found.nodes[i]];
+            std::uint32_t cluster = get_cluster(previous);
+            if ( cluster != get_cluster(next) ) {
+                cells.push_back(next);
+                continue;
+            }
+            local_search search(*grid, static_cast<int>(cluster) / cluster_columns * cluster_size, static_cast<int>(cluster) % cluster_columns * cluster_size, cluster_size, previous, false);
+            cells.pop_back();
+            search.append_path(next, cells);
+        }
+        cells.pop_back();
+        found.goal_search->append_path(nodes[found.nodes.back()], cells);
+    }
+
+    state_pointer path = nullptr;
+    for ( std::uint32_t cell : cells ) {
+        path = std::make_shared<const maze_state>(path, grid, std::make_pair(static_cast<int>(cell) / grid->columns, static_cast<int>(cell) % grid->columns));
+    }
+    return path;
+}
+
+int maze_hierarchy::get_cluster_size () const {
+    return cluster_size;
+}
+
+std::size_t maze_hierarchy::get_num_nodes () const {
+    return nodes.size();
+}
+
+std::size_t maze_hierarchy::get_num_edges () const {
+    return edge_targets.size();
+}
+
+void maze_hierarchy::index_clusters () {
+    int cluster_rows = ( grid->rows + cluster_size - 1 ) / cluster_size;
+    cluster_starts.assign(static_cast<std::size_t>(cluster_rows) * cluster_columns + 1, 0);
+    for ( std::uint32_t cell : nodes ) ++cluster_starts[get_cluster(cell) + 1];
+    for ( std::size_t cluster = 1; cluster < cluster_starts.size(); ++cluster ) cluster_starts[cluster] += cluster_starts[cluster - 1];
+}
+
+std::uint32_t maze_hierarchy::get_cluster ( std::uint32_t cell ) const {
+    int row = static_cast<int>(cell) / grid->columns;
+    int column = static_cast<int>(cell) % grid->columns;
+    return static_cast<std::uint32_t>(row / cluster_size * cluster_columns + column / cluster_size);
+}
+
+std::uint32_t maze_hierarchy::get_cell ( std::pair<int, int> position ) const {
+    auto [row, column] = position;
+    if ( row < 0 || row >= grid->rows || column < 0 || column >= grid->columns ) {
+        throw std::invalid_argument("Position (" + std::to_string(row) + ", " + std::to_string(column) + ") is outside the maze.");
+    }
+    auto cell = static_cast<std::uint32_t>(row * grid->columns + column);
+    if ( grid->cells[cell] == maze_state::WALL ) throw std::invalid_argument("Position (" + std::to_string(row) + ", " + std::to_string(column) + ") is a wall.");
+    return cell;
+}
+
+maze_hierarchy::route maze_hierarchy::search ( std::uint32_t from, std::uint32_t to ) const {
+    route found;
+    std::uint32_t start_cluster = get_cluster(from), goal_cluster = get_cluster(to);
+    auto make_search = [this]( std::uint32_t cluster, std::uint32_t source, bool reverse ) {
+        return std::make_unique<local_search>(*grid, static_cast<int>(cluster) / cluster_columns * cluster_size,
+                                              static_cast<int>(cluster) % cluster_columns * cluster_size, cluster_size, source, reverse);
+    };
+    found.start_search = make_search(start_cluster, from, false);
+    found.goal_search = make_search(goal_cluster, to, true);
+
+    // A* over the nodes, the start and the goal being the extra nodes SOURCE and TARGET
+    const auto SOURCE = static_cast<std::uint32_t>(nodes.size()), TARGET = SOURCE + 1;
+    int goal_row = static_cast<int>(to) / grid->columns, goal_column = static_cast<int>(to) % grid->columns;
+    auto get_heuristic = [&]( std::uint32_t node ) -> unsigned long long {
+        if ( node >= SOURCE ) return 0;
+        int row = static_cast<int>(nodes[node]) / grid->columns, column = static_cast<int>(nodes[node]) % grid->columns;
+        return static_cast<unsigned long long>(std::abs(row - goal_row) + std::abs(column - goal_column));
+    };
+
+    std::unordered_map<std::uint32_t, std::pair<unsigned long long, std::uint32_t>> labels; // node -> (cost, parent)
+    using entry = std::tuple<unsigned long long, unsigned long long, std::uint32_t>; // (estimate, cost, node)
+    std::priority_queue<entry, std::vector<entry>, std::greater<>> queue;
+    auto relax = [&]( std::uint32_t node, std::uint32_t parent, unsigned long long cost ) {
+        auto [label, inserted] = labels.try_emplace(node, cost, parent);
+        if ( !inserted ) {
+            if ( cost >= label->second.first ) return;
+            label->second = { cost, parent };
+        }
+        queue.emplace(cost + get_heuristic(node), cost, node);
+    };
+
+    relax(SOURCE, SOURCE, 0);
+    while ( !queue.empty() ) {
+        auto [estimate, cost, node] = queue.top();
+        queue.pop();
+        if ( cost > labels[node].first ) continue;
+        if ( node == TARGET ) break;
+
+        if ( node == SOURCE ) {
+            for ( std::uint32_t next = cluster_starts[start_cluster]; next < cluster_starts[start_cluster + 1]; ++next ) {
+                unsigned long long step = found.start_search->get_cost(nodes[next]);
+                if ( step != state::UNREACHABLE ) relax(next, node, step);
+            }
+            if ( start_cluster == goal_cluster && found.start_search->get_cost(to) != state::UNREACHABLE ) relax(TARGET, node, found.start_search->get_cost(to));
+            continue;
+        }
+
+        for ( std::uint32_t i = edge_starts[node]; i < edge_starts[node + 1]; ++i ) relax(edge_targets[i], node, cost + edge_costs[i]);
+        if ( get_cluster(nodes[node]) == goal_cluster ) {
+            unsigned long long step = found.goal_search->get_cost(nodes[node]);
+            if ( step != state::UNREACHABLE ) relax(TARGET, node, cost + step);
+        }
+    }
+
+    auto target = labels.find(TARGET);
+    if ( target == labels.end() ) return found;
+    found.cost = target->second.first;
+    for ( std::uint32_t node = target->second.second; node != SOURCE; node = labels[node].second ) found.nodes.push_back(node);
+    std::reverse(found.nodes.begin(), found.nodes.end());
+    return found;
+}
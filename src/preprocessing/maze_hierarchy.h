@@ -0,0 +1,173 @@
+/**
+ * @file maze_hierarchy.h
+ * @brief Declares the maze_hierarchy class, a hierarchical abstraction of a maze for fast repeated path queries.
+ *
+ * This header file defines the `maze_hierarchy` class, an HPA*-style abstraction. The grid is split into square
+ * clusters, the open cells on the cluster borders become the nodes of an abstract graph, and the cheapest paths
+ * between the border cells of every cluster are precomputed (in parallel, one cluster per task). A query searches
+ * the abstract graph and then refines only the clusters the route passes, so its cost depends on the length of the
+ * route rather than on the size of the maze. The abstraction can be saved next to the maze and is rebuilt when the
+ * maze it was built for changes.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef MAZE_HIERARCHY_H
+#define MAZE_HIERARCHY_H
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../generators/maze_generator.h"
+
+
+/**
+ * @brief Abstract graph of the cluster borders of a maze.
+ *
+ * Every open cell with an open neighbour in another cluster is a node. A node has an edge to each such neighbour
+ * (the cost of entering it) and to every node of its own cluster reachable inside the cluster (the cost of the
+ * cheapest path staying in the cluster). Since every border crossing is a node, any path of the maze is a chain of
+ * these edges, so the routes found are optimal, not just near-optimal as with HPA* entrances merged per border.
+ *
+ * A query links the start to the nodes of its cluster and the nodes of the goal's cluster to the goal with two
+ * searches restricted to those clusters, runs A* (Manhattan distance) on the abstract graph and refines every
+ * intra-cluster edge of the result with one more restricted search. The hierarchy is read-only after construction
+ * and can be queried from several threads at once.
+ */
+class maze_hierarchy {
+public:
+    /**
+     * @brief Default width and height of a cluster in cells.
+     */
+    static constexpr int DEFAULT_CLUSTER_SIZE = 16;
+
+    /**
+     * @brief Largest width and height of a cluster in cells.
+     */
+    static constexpr int MAX_CLUSTER_SIZE = 256;
+
+    /**
+     * @brief Builds the hierarchy of a maze, the clusters in parallel.
+     *
+     * @param grid The maze grid, kept by the hierarchy.
+     * @param cluster_size The width and height of a cluster in cells.
+     * @return The hierarchy.
+     * @throws std::invalid_argument if the cluster size is not between 1 and `MAX_CLUSTER_SIZE`.
+     */
+    static std::shared_ptr<const maze_hierarchy> build ( std::shared_ptr<const maze_state::grid_layout> grid, int cluster_size = DEFAULT_CLUSTER_SIZE );
+
+    /**
+     * @brief Loads a hierarchy saved by `save`.
+     *
+     * @param filename The file to read.
+     * @param grid The maze grid the hierarchy must belong to.
+     * @return The hierarchy, or nullptr if it was built for a different maze.
+     * @throws std::runtime_error if the file cannot be read or is not a valid hierarchy.
+     */
+    static std::shared_ptr<const maze_hierarchy> load ( const std::string &filename, std::shared_ptr<const maze_state::grid_layout> grid );
+
+    /**
+     * @brief Loads the hierarchy of a maze from a cache file, or builds and saves it if the file is missing or stale.
+     *
+     * @param grid The maze grid.
+     * @param cluster_size The width and height of a cluster in cells.
+     * @param cache_filename The cache file, or empty to build without caching.
+     * @return The hierarchy.
+     */
+    static std::shared_ptr<const maze_hierarchy> create ( std::shared_ptr<const maze_state::grid_layout> grid, int cluster_size = DEFAULT_CLUSTER_SIZE,
+                                                          const std::string &cache_filename = "" );
+
+    /**
+     * @brief Saves the hierarchy to a file, together with a fingerprint of its maze.
+     *
+     * @param filename The file to write (replaced atomically).
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    void save ( const std::string &filename ) const;
+
+    /**
+     * @brief Returns the cost of the cheapest path between two cells, searching the abstract graph only.
+     *
+     * @param from The (row, column) position of the first cell.
+     * @param to The (row, column) position of the second cell.
+     * @return The sum of the weights of the cells entered, or `state::UNREACHABLE` if there is no path.
+     * @throws std::invalid_argument if a position is outside the maze or a wall.
+     */
+    [[nodiscard]] unsigned long long get_cost ( std::pair<int, int> from, std::pair<int, int> to ) const;
+
+    /**
+     * @brief Finds the cheapest path between two cells.
+     *
+     * @param from The (row, column) position of the first cell.
+     * @param to The (row, column) position of the second cell.
+     * @return The `maze_state` of `to`, its predecessors walk every cell back to `from` (whose predecessor is null),
+     *         or nullptr if there is no path.
+     * @throws std::invalid_argument if a position is outside the maze or a wall.
+     */
+    [[nodiscard]] state_pointer find_path ( std::pair<int, int> from, std::pair<int, int> to ) const;
+
+    /**
+     * @brief Returns the width and height of a cluster in cells.
+     */
+    [[nodiscard]] int get_cluster_size () const;
+
+    /**
+     * @brief Returns the number of nodes of the abstract graph.
+     */
+    [[nodiscard]] std::size_t get_num_nodes () const;
+
+    /**
+     * @brief Returns the number of edges of the abstract graph.
+     */
+    [[nodiscard]] std::size_t get_num_edges () const;
+
+private:
+    /**
+     * @brief The abstract nodes of a route, with the costs of the searches that linked the start and the goal.
+     */
+    struct route;
+
+    /**
+     * @brief Constructor for an empty hierarchy, used by `build` and `load`.
+     */
+    maze_hierarchy ( std::shared_ptr<const maze_state::grid_layout> grid, int cluster_size );
+
+    /**
+     * @brief Groups the nodes by cluster, `nodes` must be sorted by cluster.
+     */
+    void index_clusters ();
+
+    /**
+     * @brief Returns the cluster of a cell.
+     */
+    [[nodiscard]] std::uint32_t get_cluster ( std::uint32_t cell ) const;
+
+    /**
+     * @brief Returns the cell of a position.
+     *
+     * @throws std::invalid_argument if the position is outside the maze or a wall.
+     */
+    [[nodiscard]] std::uint32_t get_cell ( std::pair<int, int> position ) const;
+
+    /**
+     * @brief Searches the abstract graph between two cells.
+     */
+    [[nodiscard]] route search ( std::uint32_t from, std::uint32_t to ) const;
+
+    std::shared_ptr<const maze_state::grid_layout> grid; ///< The maze.
+    int cluster_size; ///< The width and height of a cluster.
+    int cluster_columns; ///< The number of clusters per row of the maze.
+    std::vector<std::uint32_t> nodes; ///< The cell of every node, sorted by cluster and then by cell.
+    std::vector<std::uint32_t> cluster_starts; ///< Offset of the nodes of every cluster, plus the end offset.
+    std::vector<std::uint32_t> edge_starts; ///< Offset of the edges of every node, plus the end offset.
+    std::vector<std::uint32_t> edge_targets; ///< The node every edge leads to.
+    std::vector<std::uint32_t> edge_costs; ///< The cost of every edge.
+};
+
+#endif //MAZE_HIERARCHY_H
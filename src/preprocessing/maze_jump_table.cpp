@@ -0,0 +1,65 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "maze_jump_table.h"
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+maze_jump_table::maze_jump_table ( const maze_state::grid_layout &grid ) {
+    if ( grid.rows > MAX_SIZE || grid.columns > MAX_SIZE ) throw std::invalid_argument("Jump tables support mazes of at most " + std::to_string(MAX_SIZE) + " rows and columns.");
+    int rows = grid.rows, columns = grid.columns;
+    jumps.assign(grid.cells.size(), { 0, 0, 0, 0 });
+
+    auto is_open = [&grid, rows, columns]( int row, int column ) {
+        return row >= 0 && row < rows && column >= 0 && column < columns && grid.cells[row * columns + column] != maze_state::WALL;
+    };
+    // A cell reached by a move of (row_step, column_step) has a forced neighbour beside it that is walled one step back
+    auto is_forced = [&is_open]( int row, int column, int row_step, int column_step ) {
+        if ( row_step == 0 ) {
+            return ( is_open(row - 1, column) && !is_open(row - 1, column - column_step) ) || ( is_open(row + 1, column) && !is_open(row + 1, column - column_step) );
+        }
+        return ( is_open(row, column - 1) && !is_open(row - row_step, column - 1) ) || ( is_open(row, column + 1) && !is_open(row - row_step, column + 1) );
+    };
+    // Every cell continues the jump of the next cell in the direction, so each line is scanned against the move
+    auto scan = [&]( int row, int column, int row_step, int column_step, direction move ) {
+        int next_row = row + row_step, next_column = column + column_step;
+        if ( !is_open(row, column) || !is_open(next_row, next_column) ) return;
+
+        auto next = static_cast<std::size_t>(next_row * columns + next_column);
+        bool jump_point = is_forced(next_row, next_column, row_step, column_step)
+                          || ( row_step != 0 && ( jumps[next][LEFT] > 0 || jumps[next][RIGHT] > 0 ) );
+        int next_jump = jumps[next][move];
+        jumps[static_cast<std::size_t>(row * columns + column)][move] = static_cast<std::int16_t>(jump_point ? 1 : next_jump > 0 ? next_jump + 1 : next_jump - 1);
+    };
+
+    // The vertical jumps depend on the horizontal ones
+    for ( int row = 0; row < rows; ++row ) {
+        for ( int column = 0; column < columns; ++column ) scan(row, column, 0, -1, LEFT);
+        for ( int column = columns - 1; column >= 0; --column ) scan(row, column, 0, 1, RIGHT);
+    }
+    for ( int row = 0; row < rows; ++row ) {
+        for ( int column = 0; column < columns; ++column ) scan(row, column, -1, 0, UP);
+    }
+    for ( int row = rows - 1; row >= 0; --row ) {
+        for ( int column = 0; column < columns; ++column ) scan(row, column, 1, 0, DOWN);
+    }
+}
+
+std::shared_ptr<const maze_jump_table> maze_jump_table::get ( const std::shared_ptr<const maze_state::grid_layout> &grid ) {
+    static std::mutex mutex;
+    static std::map<const maze_state::grid_layout*, std::pair<std::weak_ptr<const maze_state::grid_layout>, std::shared_ptr<const maze_jump_table>>> tables;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::erase_if(tables, []( const auto &entry ) { return entry.second.first.expired(); });
+
+    // The grid pointer is compared too, a new grid may reuse the address of a destroyed one
+    auto found = tables.find(grid.get());
+    if ( found != tables.end() && found->second.first.lock() == grid ) return found->second.second;
+    auto table = std::make_shared<const maze_jump_table>(*grid);
+    tables[grid.get()] = { grid, table };
+    return table;
+}
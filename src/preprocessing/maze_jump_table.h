@@ -0,0 +1,82 @@
+/**
+ * @file maze_jump_table.h
+ * @brief Declares the maze_jump_table class, the precomputed jumps of jump point search (JPS+) on a maze grid.
+ *
+ * This header file defines the `maze_jump_table` class. For every open cell and each of the four directions it stores
+ * how far a straight move may go before it reaches a jump point (a cell where the search must stop and branch) or a
+ * wall. Jump point search then crosses long corridors and open areas in one step per jump, reading a single entry
+ * instead of scanning the cells.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef MAZE_JUMP_TABLE_H
+#define MAZE_JUMP_TABLE_H
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../generators/maze_generator.h"
+
+
+/**
+ * @brief Jump distances of the four straight moves from every cell of a maze (4-connected JPS+).
+ *
+ * A horizontal move stops at a cell with a forced neighbour: an open cell above or below it whose counterpart one
+ * step back is a wall, so no canonical path could have turned there earlier. A vertical move also stops at a cell
+ * from which a horizontal move reaches a jump point. Entry `d` of a cell is the distance to the first jump point in
+ * direction `d`, or zero minus the number of open cells before the next wall if the move reaches none. Goals are not
+ * part of the table, the search checks them when it jumps. Every entry is 16 bits, 8 bytes per cell.
+ */
+class maze_jump_table {
+public:
+    /**
+     * @brief The four moves, in the order of `maze_state::get_descendents`.
+     */
+    enum direction { LEFT, RIGHT, UP, DOWN };
+
+    /**
+     * @brief Largest number of rows and columns of a maze, jump distances are 16-bit.
+     */
+    static constexpr int MAX_SIZE = 32767;
+
+    /**
+     * @brief Computes the table of a maze.
+     *
+     * @param grid The maze grid.
+     * @throws std::invalid_argument if the maze has more than `MAX_SIZE` rows or columns.
+     */
+    explicit maze_jump_table ( const maze_state::grid_layout &grid );
+
+    /**
+     * @brief Returns the table of a maze, computing it on the first request.
+     *
+     * Tables are kept while their grid exists, so repeated searches of the same maze (benchmark runs, daemon
+     * requests) share one table.
+     *
+     * @param grid The maze grid.
+     * @return The table of the grid.
+     */
+    static std::shared_ptr<const maze_jump_table> get ( const std::shared_ptr<const maze_state::grid_layout> &grid );
+
+    /**
+     * @brief Returns the jump of a move.
+     *
+     * @param cell The cell the move starts from (row-major index).
+     * @param move The direction of the move.
+     * @return The distance to the next jump point, or zero minus the number of open cells before the wall.
+     */
+    [[nodiscard]] int get_jump ( std::uint32_t cell, direction move ) const {
+        return jumps[cell][move];
+    }
+
+private:
+    std::vector<std::array<std::int16_t, 4>> jumps; ///< The jumps of every cell (row-major), indexed by direction.
+};
+
+#endif //MAZE_JUMP_TABLE_H
@@ -0,0 +1,135 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "maze_tree_index.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    /**
+     * @brief Node of the cells that are walls.
+     */
+    constexpr std::uint32_t NO_NODE = ~std::uint32_t(0);
+}
+
+maze_tree_index::maze_tree_index ( std::shared_ptr<const maze_state::grid_layout> grid ) : grid( std::move(grid) ) {
+    const maze_state::grid_layout &layout = *this->grid;
+    std::size_t num_cells = layout.cells.size();
+
+    // A connected graph is a tree if it has one edge less than nodes
+    std::size_t num_open = 0, num_edges = 0;
+    std::uint32_t root = NO_NODE;
+    for ( std::size_t cell = 0; cell < num_cells; ++cell ) {
+        if ( layout.cells[cell] == maze_state::WALL ) continue;
+        if ( root == NO_NODE ) root = static_cast<std::uint32_t>(cell);
+        ++num_open;
+        std::size_t column = cell % layout.columns;
+        if ( column + 1 < static_cast<std::size_t>(layout.columns) && layout.cells[cell + 1] != maze_state::WALL ) ++num_edges;
+        if ( cell + layout.columns < num_cells && layout.cells[cell + layout.columns] != maze_state::WALL ) ++num_edges;
+    }
+    if ( num_open == 0 ) throw std::invalid_argument("The maze has no open cell.");
+    if ( num_edges != num_open - 1 ) throw std::invalid_argument("The open cells of the maze contain a loop or are not connected.");
+
+    // Number the cells in depth-first preorder, so every subtree is a contiguous range of nodes
+    node_of.assign(num_cells, NO_NODE);
+    cells.reserve(num_open);
+    parents.reserve(num_open);
+    depths.reserve(num_open);
+    root_costs.reserve(num_open);
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> stack { { root, NO_NODE } };
+    while ( !stack.empty() ) {
+        auto [cell, parent] = stack.back();
+        stack.pop_back();
+
+        auto node = static_cast<std::uint32_t>(cells.size());
+        node_of[cell] = node;
+        cells.push_back(cell);
+        parents.push_back(parent == NO_NODE ? node : parent);
+        depths.push_back(parent == NO_NODE ? 0 : depths[parent] + 1);
+        root_costs.push_back(( parent == NO_NODE ? 0 : root_costs[parent] ) + layout.get_weight(cell));
+
+        layout.for_each_neighbour(cell, [this, &layout, &stack, node]( std::uint32_t next ) {
+            if ( layout.cells[next] != maze_state::WALL && node_of[next] == NO_NODE ) stack.emplace_back(next, node);
+        });
+    }
+    if ( cells.size() != num_open ) throw std::invalid_argument("The open cells of the maze contain a loop or are not connected.");
+
+    // Level k keeps the shallower node of two ranges of level k - 1
+    sparse_table.emplace_back(num_open);
+    for ( std::uint32_t node = 0; node < num_open; ++node ) sparse_table[0][node] = node;
+    for ( std::size_t width = 2; width <= num_open; width *= 2 ) {
+        const std::vector<std::uint32_t> &previous = sparse_table.back();
+        std::vector<std::uint32_t> level(num_open - width + 1);
+        for ( std::size_t i = 0; i < level.size(); ++i ) {
+            std::uint32_t left = previous[i], right = previous[i + width / 2];
+            level[i] = depths[right] < depths[left] ? right : left;
+        }
+        sparse_table.push_back(std::move(level));
+    }
+}
+
+unsigned int maze_tree_index::get_distance ( std::pair<int, int> from, std::pair<int, int> to ) const {
+    std::uint32_t first = get_node(from), second = get_node(to);
+    return depths[first] + depths[second] - 2 * depths[get_ancestor(first, second)];
+}
+
+unsigned long long maze_tree_index::get_cost ( std::pair<int, int> from, std::pair<int, int> to ) const {
+    std::uint32_t first = get_node(from), second = get_node(to);
+    std::uint32_t ancestor = get_ancestor(first, second);
+
+    // The root costs count the ancestor twice and the first cell, which is not entered, once
+    return root_costs[first] + root_costs[second] - 2 * root_costs[ancestor]
+           + grid->get_weight(cells[ancestor]) - grid->get_weight(cells[first]);
+}
+
+std::pair<int, int> maze_tree_index::get_meeting_cell ( std::pair<int, int> from, std::pair<int, int> to ) const {
+    return get_position(get_ancestor(get_node(from), get_node(to)));
+}
+
+state_pointer maze_tree_index::get_path ( std::pair<int, int> from, std::pair<int, int> to ) const {
+    std::uint32_t first = get_node(from), second = get_node(to);
+    std::uint32_t ancestor = get_ancestor(first, second);
+
+    // Climb from the first cell to the ancestor, then descend to the second cell
+    std::vector<std::uint32_t> descent;
+    for ( std::uint32_t node = second; node != ancestor; node = parents[node] ) descent.push_back(node);
+
+    state_pointer path = nullptr;
+    for ( std::uint32_t node = first; node != ancestor; node = parents[node] ) path = std::make_shared<const maze_state>(path, grid, get_position(node));
+    path = std::make_shared<const maze_state>(path, grid, get_position(ancestor));
+    for ( auto it = descent.rbegin(); it != descent.rend(); ++it ) path = std::make_shared<const maze_state>(path, grid, get_position(*it));
+    return path;
+}
+
+std::size_t maze_tree_index::get_num_cells () const {
+    return cells.size();
+}
+
+std::uint32_t maze_tree_index::get_node ( std::pair<int, int> position ) const {
+    auto [row, column] = position;
+    if ( row < 0 || row >= grid->rows || column < 0 || column >= grid->columns ) {
+        throw std::invalid_argument("Position (" + std::to_string(row) + ", " + std::to_string(column) + ") is outside the maze.");
+    }
+    std::uint32_t node = node_of[static_cast<std::size_t>(row) * grid->columns + column];
+    if ( node == NO_NODE ) throw std::invalid_argument("Position (" + std::to_string(row) + ", " + std::to_string(column) + ") is a wall.");
+    return node;
+}
+
+std::uint32_t maze_tree_index::get_ancestor ( std::uint32_t first, std::uint32_t second ) const {
+    if ( first == second ) return first;
+    if ( first > second ) std::swap(first, second);
+
+    // The shallowest node visited after the first one up to the second is a child of the ancestor
+    std::uint32_t begin = first + 1;
+    auto level = static_cast<std::size_t>(std::bit_width(second - begin + 1) - 1);
+    std::uint32_t left = sparse_table[level][begin], right = sparse_table[level][second + 1 - ( std::uint32_t(1) << level )];
+    return parents[depths[right] < depths[left] ? right : left];
+}
+
+std::pair<int, int> maze_tree_index::get_position ( std::uint32_t node ) const {
+    return { static_cast<int>(cells[node]) / grid->columns, static_cast<int>(cells[node]) % grid->columns };
+}
@@ -0,0 +1,121 @@
+/**
+ * @file maze_tree_index.h
+ * @brief Declares the maze_tree_index class, which answers path queries between any two cells of a perfect maze.
+ *
+ * This header file defines the `maze_tree_index` class. Mazes carved by a recursive backtracker have no loops, so
+ * their open cells form a tree and the path between two cells is unique: it climbs from both of them to their lowest
+ * common ancestor (LCA). The index roots the tree once, stores the depth and the cost from the root of every cell,
+ * and finds LCAs in constant time with a sparse table, so a distance or cost query needs no search at all.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef MAZE_TREE_INDEX_H
+#define MAZE_TREE_INDEX_H
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../generators/maze_generator.h"
+
+
+/**
+ * @brief Constant-time distance and cost queries between the cells of a maze without loops.
+ *
+ * The open cells are numbered in the order a depth-first walk from the first open cell reaches them (the first
+ * visits of its Euler tour). For two cells `u` and `v` with `u` visited first, the LCA is the parent of the
+ * shallowest cell visited after `u` up to `v` (or `u` itself if it is an ancestor of `v`), a range minimum the
+ * sparse table answers with two lookups. The table holds `log2(n)` levels of `n` entries.
+ *
+ * Distances count moves, costs sum the weights of the cells entered (as `maze_state::get_step_cost`), so both equal
+ * the path length and cost a search from one cell to the other would report. Paths are rebuilt in time linear in
+ * their length. The index is read-only after construction and can be queried from several threads at once.
+ */
+class maze_tree_index {
+public:
+    /**
+     * @brief Builds the index of a maze.
+     *
+     * @param grid The maze grid, kept by the index.
+     * @throws std::invalid_argument if the grid has no open cell, or its open cells are not connected or form a loop.
+     */
+    explicit maze_tree_index ( std::shared_ptr<const maze_state::grid_layout> grid );
+
+    /**
+     * @brief Returns the number of moves between two cells.
+     *
+     * @param from The (row, column) position of the first cell.
+     * @param to The (row, column) position of the second cell.
+     * @return The length of the path between the cells.
+     * @throws std::invalid_argument if a position is outside the maze or a wall.
+     */
+    [[nodiscard]] unsigned int get_distance ( std::pair<int, int> from, std::pair<int, int> to ) const;
+
+    /**
+     * @brief Returns the cost of moving from one cell to another.
+     *
+     * @param from The (row, column) position of the first cell.
+     * @param to The (row, column) position of the second cell.
+     * @return The sum of the weights of the cells entered, `to` included and `from` excluded.
+     * @throws std::invalid_argument if a position is outside the maze or a wall.
+     */
+    [[nodiscard]] unsigned long long get_cost ( std::pair<int, int> from, std::pair<int, int> to ) const;
+
+    /**
+     * @brief Returns the cell where the paths from two cells to the root meet.
+     *
+     * @param from The (row, column) position of the first cell.
+     * @param to The (row, column) position of the second cell.
+     * @return The (row, column) position of the cell of the path between them closest to the root.
+     * @throws std::invalid_argument if a position is outside the maze or a wall.
+     */
+    [[nodiscard]] std::pair<int, int> get_meeting_cell ( std::pair<int, int> from, std::pair<int, int> to ) const;
+
+    /**
+     * @brief Rebuilds the path from one cell to another.
+     *
+     * @param from The (row, column) position of the first cell.
+     * @param to The (row, column) position of the second cell.
+     * @return The `maze_state` of `to`, its predecessors walk every cell back to `from` (whose predecessor is null).
+     * @throws std::invalid_argument if a position is outside the maze or a wall.
+     */
+    [[nodiscard]] state_pointer get_path ( std::pair<int, int> from, std::pair<int, int> to ) const;
+
+    /**
+     * @brief Returns the number of open cells of the maze.
+     */
+    [[nodiscard]] std::size_t get_num_cells () const;
+
+private:
+    /**
+     * @brief Returns the index node of a position.
+     *
+     * @throws std::invalid_argument if the position is outside the maze or a wall.
+     */
+    [[nodiscard]] std::uint32_t get_node ( std::pair<int, int> position ) const;
+
+    /**
+     * @brief Returns the lowest common ancestor of two nodes.
+     */
+    [[nodiscard]] std::uint32_t get_ancestor ( std::uint32_t first, std::uint32_t second ) const;
+
+    /**
+     * @brief Returns the (row, column) position of a node.
+     */
+    [[nodiscard]] std::pair<int, int> get_position ( std::uint32_t node ) const;
+
+    std::shared_ptr<const maze_state::grid_layout> grid; ///< The indexed maze.
+    std::vector<std::uint32_t> node_of; ///< The node of every cell (row-major), `UINT32_MAX` for walls.
+    std::vector<std::uint32_t> cells; ///< The cell of every node, nodes are numbered in depth-first order.
+    std::vector<std::uint32_t> parents; ///< The parent of every node, the root is its own parent.
+    std::vector<std::uint32_t> depths; ///< The number of moves from the root to every node.
+    std::vector<unsigned long long> root_costs; ///< The weights of the cells from the root to every node, both included.
+    std::vector<std::vector<std::uint32_t>> sparse_table; ///< Level `k` holds the shallowest node of every range of `2^k` nodes.
+};
+
+#endif //MAZE_TREE_INDEX_H
@@ -0,0 +1,98 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "sat_decomposer.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief Returns the representative of a variable's set, halving the path on the way.
+     */
+    int find_root ( std::vector<int> &parents, int variable ) {
+        while ( parents[variable] != variable ) {
+            parents[variable] = parents[parents[variable]];
+            variable = parents[variable];
+        }
+        return variable;
+    }
+}
+
+sat_decomposition sat_decomposer::decompose ( const sat_problem &problem, const std::map<int, bool> &assignment ) {
+    sat_decomposition decomposition;
+
+    // Drop the clauses satisfied by the assignment and the false literals of the others
+    std::vector<clause> remaining;
+    for ( const clause &clause : problem.clauses ) {
+        ::clause reduced;
+        bool satisfied = false;
+        for ( const literal &literal : clause.literals ) {
+            if ( literal.variable_id < 1 || literal.variable_id > problem.num_variables ) throw std::invalid_argument("SAT literal refers to an unknown variable.");
+            auto value = assignment.find(literal.variable_id);
+            if ( value == assignment.end() ) reduced.literals.push_back(literal);
+            else if ( value->second != literal.negated ) satisfied = true;
+        }
+        if ( satisfied ) continue;
+        if ( reduced.literals.empty() ) {
+            decomposition.unsatisfiable = true;
+            return decomposition;
+        }
+        remaining.push_back(std::move(reduced));
+    }
+
+    // Union the variables of every clause
+    std::vector<int> parents(problem.num_variables + 1);
+    std::iota(parents.begin(), parents.end(), 0);
+    std::vector<bool> constrained(problem.num_variables + 1, false);
+    for ( const clause &clause : remaining ) {
+        int first = find_root(parents, clause.literals.front().variable_id);
+        for ( const literal &literal : clause.literals ) {
+            constrained[literal.variable_id] = true;
+            int root = find_root(parents, literal.variable_id);
+            if ( root != first ) parents[root] = first;
+        }
+    }
+
+    // Number the variables of every component in their original order
+    std::vector<int> component_of(problem.num_variables + 1, -1);
+    std::vector<int> local_id(problem.num_variables + 1, 0);
+    for ( int variable = 1; variable <= problem.num_variables; ++variable ) {
+        auto value = assignment.find(variable);
+        if ( value != assignment.end() ) {
+            decomposition.fixed_values[variable] = value->second;
+            continue;
+        }
+        if ( !constrained[variable] ) {
+            decomposition.fixed_values[variable] = false;
+            continue;
+        }
+
+        int root = find_root(parents, variable);
+        if ( component_of[root] < 0 ) {
+            component_of[root] = static_cast<int>(decomposition.components.size());
+            decomposition.components.emplace_back();
+        }
+        sat_component &component = decomposition.components[component_of[root]];
+        component.original_variables.push_back(variable);
+        local_id[variable] = static_cast<int>(component.original_variables.size());
+    }
+
+    for ( clause &clause : remaining ) {
+        sat_component &component = decomposition.components[component_of[find_root(parents, clause.literals.front().variable_id)]];
+        for ( literal &literal : clause.literals ) literal.variable_id = local_id[literal.variable_id];
+        component.problem.clauses.push_back(std::move(clause));
+    }
+    for ( sat_component &component : decomposition.components ) {
+        component.problem.num_variables = static_cast<int>(component.original_variables.size());
+        component.problem.num_clauses = static_cast<int>(component.problem.clauses.size());
+    }
+
+    // Largest first, so parallel workers do not start the longest search last
+    std::stable_sort(decomposition.components.begin(), decomposition.components.end(), []( const sat_component &a, const sat_component &b ) {
+        return a.problem.num_variables > b.problem.num_variables;
+    });
+    return decomposition;
+}
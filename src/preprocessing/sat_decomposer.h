@@ -0,0 +1,62 @@
+/**
+ * @file sat_decomposer.h
+ * @brief Declares the sat_decomposer class, which splits SAT problems into independent components.
+ *
+ * This header file defines the `sat_decomposer` class and the `sat_component` and `sat_decomposition` structs.
+ * Two variables are connected when they occur in the same clause; every connected component of this graph is a
+ * separate SAT problem, and the problem is satisfiable exactly when every component is. Solving the components
+ * one by one explores the sum of their state spaces instead of their product.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef SAT_DECOMPOSER_H
+#define SAT_DECOMPOSER_H
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "../generators/sat_generator.h"
+
+
+/**
+ * @brief One independent part of a SAT problem.
+ */
+struct sat_component {
+    sat_problem problem; ///< The clauses of the component, variables numbered 1 to `problem.num_variables`.
+    std::vector<int> original_variables; ///< The original identifier of every component variable, indexed by its identifier minus one.
+};
+
+/**
+ * @brief A SAT problem split into independent components.
+ */
+struct sat_decomposition {
+    bool unsatisfiable = false; ///< Set if a clause is falsified by the given assignment.
+    std::vector<sat_component> components; ///< The components, largest first.
+    std::map<int, bool> fixed_values; ///< The values of the variables outside every component (assigned or unconstrained).
+};
+
+
+/**
+ * @brief Splits SAT problems into the connected components of their clause-variable graph.
+ */
+class sat_decomposer {
+public:
+    /**
+     * @brief Splits a partially assigned SAT problem into independent components.
+     *
+     * Clauses satisfied by the assignment are dropped and its false literals removed first. The variables in no
+     * remaining clause are unconstrained and get the value false, the assigned ones keep their value.
+     *
+     * @param problem The problem.
+     * @param assignment The values of the variables already assigned.
+     * @return The components and the values of the variables outside them.
+     * @throws std::invalid_argument if a literal refers to a variable outside the problem.
+     */
+    static sat_decomposition decompose ( const sat_problem &problem, const std::map<int, bool> &assignment = {} );
+};
+
+#endif //SAT_DECOMPOSER_H
@@ -0,0 +1,243 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "sat_preprocessor.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief Working copy of a CNF formula, literals encoded as `2 * (variable - 1) + negated`.
+     */
+    class formula {
+    public:
+        explicit formula ( int num_variables ) : values ( num_variables, -1 ), occurrences ( 2 * static_cast<std::size_t>(num_variables) ) {}
+
+        /**
+         * @brief Adds a clause with sorted, distinct and non-complementary literals.
+         */
+        void add_clause ( std::vector<int> literals ) {
+            int index = static_cast<int>(clauses.size());
+            for ( int literal : literals ) occurrences[literal].push_back(index);
+            clauses.push_back(std::move(literals));
+            removed.push_back(false);
+        }
+
+        /**
+         * @brief Returns 1 if the literal is true, 0 if it is false and -1 if its variable is unassigned.
+         */
+        [[nodiscard]] int get_value ( int literal ) const {
+            int value = values[literal >> 1];
+            return value < 0 ? -1 : value != ( literal & 1 );
+        }
+
+        /**
+         * @brief Makes a literal true and propagates the resulting unit clauses.
+         *
+         * @return `false` if a clause became empty.
+         */
+        bool assign ( int first_literal ) {
+            std::vector<int> queue { first_literal };
+            while ( !queue.empty() ) {
+                int literal = queue.back();
+                queue.pop_back();
+
+                int value = get_value(literal);
+                if ( value == 1 ) continue;
+                if ( value == 0 ) return false;
+                values[literal >> 1] = ( literal & 1 ) ? 0 : 1;
+
+                for ( int clause : occurrences[literal] ) removed[clause] = true;
+                for ( int clause : occurrences[literal ^ 1] ) {
+                    if ( removed[clause] ) continue;
+                    int unassigned = -1;
+                    int num_unassigned = 0;
+                    for ( int other : clauses[clause] ) {
+                        if ( get_value(other) == -1 ) {
+                            unassigned = other;
+                            ++num_unassigned;
+                        }
+                    }
+                    if ( num_unassigned == 0 ) return false;
+                    if ( num_unassigned == 1 ) queue.push_back(unassigned);
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Propagates the unit clauses of the formula.
+         *
+         * @return `false` if a clause became empty.
+         */
+        bool propagate_units () {
+            for ( std::size_t clause = 0; clause < clauses.size(); ++clause ) {
+                if ( !removed[clause] && clauses[clause].size() == 1 && !assign(clauses[clause].front()) ) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Assigns every variable occurring with one polarity only.
+         *
+         * @return `true` if a variable was assigned.
+         */
+        bool eliminate_pure_literals () {
+            std::vector<int> counts(occurrences.size(), 0);
+            for ( std::size_t clause = 0; clause < clauses.size(); ++clause ) {
+                if ( removed[clause] ) continue;
+                for ( int literal : clauses[clause] ) {
+                    if ( get_value(literal) == -1 ) ++counts[literal];
+                }
+            }
+
+            // A pure literal only satisfies clauses, so assigning it cannot fail
+            bool changed = false;
+            for ( std::size_t positive = 0; positive < counts.size(); positive += 2 ) {
+                if ( ( counts[positive] == 0 ) == ( counts[positive + 1] == 0 ) ) continue;
+                assign(static_cast<int>(counts[positive] ? positive : positive + 1));
+                changed = true;
+            }
+            return changed;
+        }
+
+        /**
+         * @brief Drops the assigned literals and removes the clauses subsumed by another clause.
+         *
+         * @return `true` if a clause was removed.
+         */
+        bool remove_subsumed () {
+            for ( std::size_t clause = 0; clause < clauses.size(); ++clause ) {
+                if ( removed[clause] ) continue;
+                std::erase_if(clauses[clause], [this]( int literal ) { return get_value(literal) != -1; });
+            }
+            for ( auto &list : occurrences ) list.clear();
+            std::vector<int> order;
+            for ( std::size_t clause = 0; clause < clauses.size(); ++clause ) {
+                if ( removed[clause] ) continue;
+                order.push_back(static_cast<int>(clause));
+                for ( int literal : clauses[clause] ) occurrences[literal].push_back(static_cast<int>(clause));
+            }
+
+            // Shorter clauses first, so among equal clauses the earliest one is kept
+            std::stable_sort(order.begin(), order.end(), [this]( int a, int b ) { return clauses[a].size() < clauses[b].size(); });
+
+            bool changed = false;
+            for ( int clause : order ) {
+                if ( removed[clause] ) continue;
+                const std::vector<int> &literals = clauses[clause];
+                int rarest = *std::min_element(literals.begin(), literals.end(), [this]( int a, int b ) {
+                    return occurrences[a].size() < occurrences[b].size();
+                });
+                for ( int other : occurrences[rarest] ) {
+                    if ( other == clause || removed[other] || clauses[other].size() < literals.size() ) continue;
+                    if ( std::includes(clauses[other].begin(), clauses[other].end(), literals.begin(), literals.end()) ) {
+                        removed[other] = true;
+                        changed = true;
+                    }
+                }
+            }
+            return changed;
+        }
+
+        std::vector<std::vector<int>> clauses; ///< The literals of every clause, sorted.
+        std::vector<bool> removed; ///< Whether every clause is satisfied or subsumed.
+        std::vector<std::int8_t> values; ///< The value of every variable, -1 if unassigned.
+        std::vector<std::vector<int>> occurrences; ///< The clauses containing each literal.
+    };
+}
+
+std::map<int, bool> sat_preprocessing_result::restore ( const std::map<int, bool> &assignment ) const {
+    std::map<int, bool> restored;
+    for ( int variable = 1; variable <= original_num_variables; ++variable ) {
+        auto fixed = fixed_values.find(variable);
+        restored[variable] = fixed != fixed_values.end() && fixed->second;
+    }
+    for ( const auto &[variable, value] : assignment ) restored[original_variables[variable - 1]] = value;
+    return restored;
+}
+
+sat_preprocessing_result sat_preprocessor::preprocess ( const sat_problem &problem ) {
+    sat_preprocessing_result result;
+    result.original_num_variables = problem.num_variables;
+    formula formula(problem.num_variables);
+
+    sat_flat_clauses flat = flatten(problem);
+    bool unsatisfiable = flat.contradiction;
+    for ( std::size_t clause = 0; clause + 1 < flat.clause_starts.size(); ++clause ) {
+        formula.add_clause(std::vector<int>(flat.literals.begin() + flat.clause_starts[clause], flat.literals.begin() + flat.clause_starts[clause + 1]));
+    }
+
+    if ( !unsatisfiable ) unsatisfiable = !formula.propagate_units();
+    bool changed = true;
+    while ( !unsatisfiable && changed ) {
+        changed = formula.eliminate_pure_literals();
+        changed = formula.remove_subsumed() || changed;
+    }
+
+    if ( unsatisfiable ) {
+        result.unsatisfiable = true;
+        result.problem.num_variables = 0;
+        result.problem.num_clauses = 1;
+        result.problem.clauses.emplace_back();
+        return result;
+    }
+
+    // Renumber the variables still occurring in a clause, in their original order
+    std::vector<int> renumbered(problem.num_variables, 0);
+    for ( std::size_t clause = 0; clause < formula.clauses.size(); ++clause ) {
+        if ( formula.removed[clause] ) continue;
+        for ( int literal : formula.clauses[clause] ) renumbered[literal >> 1] = 1;
+    }
+    for ( int variable = 0; variable < problem.num_variables; ++variable ) {
+        if ( renumbered[variable] ) {
+            result.original_variables.push_back(variable + 1);
+            renumbered[variable] = static_cast<int>(result.original_variables.size());
+        } else if ( formula.values[variable] >= 0 ) {
+            result.fixed_values[variable + 1] = formula.values[variable] == 1;
+        }
+    }
+
+    result.problem.num_variables = static_cast<int>(result.original_variables.size());
+    for ( std::size_t index = 0; index < formula.clauses.size(); ++index ) {
+        if ( formula.removed[index] ) continue;
+        clause simplified;
+        for ( int literal : formula.clauses[index] ) simplified.literals.emplace_back(renumbered[literal >> 1], ( literal & 1 ) != 0);
+        result.problem.clauses.push_back(std::move(simplified));
+    }
+    result.problem.num_clauses = static_cast<int>(result.problem.clauses.size());
+    return result;
+}
+
+sat_flat_clauses sat_preprocessor::flatten ( const sat_problem &problem, const std::map<int, bool> &assignment ) {
+    sat_flat_clauses flat;
+    std::vector<int> clause_literals;
+    for ( const clause &clause : problem.clauses ) {
+        clause_literals.clear();
+        bool satisfied = false;
+        for ( const literal &literal : clause.literals ) {
+            if ( literal.variable_id < 1 || literal.variable_id > problem.num_variables ) throw std::invalid_argument("SAT literal refers to an unknown variable.");
+            auto value = assignment.find(literal.variable_id);
+            if ( value == assignment.end() ) clause_literals.push_back(2 * ( literal.variable_id - 1 ) + ( literal.negated ? 1 : 0 ));
+            else if ( value->second != literal.negated ) satisfied = true;
+        }
+        std::sort(clause_literals.begin(), clause_literals.end());
+        clause_literals.erase(std::unique(clause_literals.begin(), clause_literals.end()), clause_literals.end());
+        for ( std::size_t i = 1; i < clause_literals.size(); ++i ) {
+            if ( ( clause_literals[i] ^ 1 ) == clause_literals[i - 1] ) satisfied = true;
+        }
+
+        if ( satisfied ) continue;
+        if ( clause_literals.empty() ) {
+            flat.contradiction = true;
+            continue;
+        }
+        flat.literals.insert(flat.literals.end(), clause_literals.begin(), clause_literals.end());
+        flat.clause_starts.push_back(static_cast<std::uint32_t>(flat.literals.size()));
+    }
+    return flat;
+}
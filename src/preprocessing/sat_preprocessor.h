@@ -0,0 +1,98 @@
+/**
+ * @file sat_preprocessor.h
+ * @brief Declares the sat_preprocessor class, which simplifies SAT problems before they are searched.
+ *
+ * This header file defines the `sat_preprocessor` class and the `sat_preprocessing_result` struct. The preprocessor
+ * runs between generating (or loading) a `sat_problem` and constructing its `sat_state`: it cleans the clauses,
+ * assigns the variables whose value is forced or free to choose, removes redundant clauses and renumbers the
+ * remaining variables densely, so the searched state space and every clause evaluation are smaller.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef SAT_PREPROCESSOR_H
+#define SAT_PREPROCESSOR_H
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "../generators/sat_generator.h"
+
+
+/**
+ * @brief A simplified SAT problem and how to map its models back to the original problem.
+ */
+struct sat_preprocessing_result {
+    sat_problem problem; ///< The simplified problem, variables numbered 1 to `problem.num_variables`.
+    bool unsatisfiable = false; ///< Set if preprocessing derived an empty clause (`problem` then holds just that clause).
+    int original_num_variables = 0; ///< The number of variables of the original problem.
+    std::vector<int> original_variables; ///< The original identifier of every simplified variable, indexed by its identifier minus one.
+    std::map<int, bool> fixed_values; ///< The values chosen for the eliminated original variables.
+
+    /**
+     * @brief Maps an assignment of the simplified problem back to the original variables.
+     *
+     * Original variables that occur in no clause after preprocessing are set to false.
+     *
+     * @param assignment An assignment of the simplified problem.
+     * @return The assignment of the original problem, a model of it if `assignment` is a model of the simplified problem.
+     */
+    [[nodiscard]] std::map<int, bool> restore ( const std::map<int, bool> &assignment ) const;
+};
+
+
+/**
+ * @brief The clauses of a SAT problem in flat arrays, as read by the clause-level solvers.
+ */
+struct sat_flat_clauses {
+    std::vector<std::uint32_t> clause_starts { 0 }; ///< Offset of every clause in `literals`, plus the end offset.
+    std::vector<int> literals; ///< The sorted literals of every clause, `2 * (variable - 1) + negated`.
+    bool contradiction = false; ///< Set if the assignment falsifies a clause (or a clause has no literal).
+};
+
+
+/**
+ * @brief Simplifies SAT problems while keeping their satisfiability.
+ *
+ * The pipeline is:
+ *   1. Duplicate literals are merged and tautological clauses (containing `x` and `¬x`) are removed.
+ *   2. Unit clauses are propagated with occurrence lists: the satisfied clauses are removed and the falsified
+ *      literals dropped, which may create more units.
+ *   3. Pure literals (variables occurring with one polarity only) are assigned to satisfy their clauses.
+ *   4. Clauses containing all literals of a shorter (or equal, earlier) clause are removed as subsumed.
+ * Steps 3 and 4 repeat until neither changes the problem. Finally, the variables still occurring in a clause are
+ * renumbered densely in their original order.
+ *
+ * Pure literal elimination keeps satisfiability but not every model, so the simplified problem answers whether a
+ * model exists and yields one through `sat_preprocessing_result::restore`, not all of them.
+ */
+class sat_preprocessor {
+public:
+    /**
+     * @brief Simplifies a SAT problem.
+     *
+     * @param problem The problem, with variables numbered 1 to `problem.num_variables`.
+     * @return The simplified problem and the mapping back to the original variables.
+     * @throws std::invalid_argument if a literal refers to a variable outside the problem.
+     */
+    static sat_preprocessing_result preprocess ( const sat_problem &problem );
+
+    /**
+     * @brief Flattens the clauses left by a partial assignment.
+     *
+     * Assigned variables are removed from the clauses, duplicate literals are merged, and tautological clauses and
+     * clauses satisfied by the assignment are dropped. Falsified clauses are dropped too and set `contradiction`.
+     *
+     * @param problem The problem, with variables numbered 1 to `problem.num_variables`.
+     * @param assignment The values of the assigned variables.
+     * @return The remaining clauses.
+     * @throws std::invalid_argument if a literal refers to a variable outside the problem.
+     */
+    static sat_flat_clauses flatten ( const sat_problem &problem, const std::map<int, bool> &assignment = {} );
+};
+
+#endif //SAT_PREPROCESSOR_H
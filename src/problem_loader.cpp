@@ -59,6 +59,10 @@ state_pointer problem_loader::load_problem ( const std::string &filename ) {
         parameters[key] = value;
     }
 
+    return create_problem(problem_type, parameters);
+}
+
+state_pointer problem_loader::create_problem ( const std::string &problem_type, const std::map<std::string, std::string> &parameters ) {
     if ( problem_type == "maze" ) {
         return generate_maze(parameters);
     } else if ( problem_type == "sat" ) {
@@ -74,8 +78,10 @@ state_pointer problem_loader::generate_maze ( const std::map<std::string, std::s
     int width = std::stoi(parameters.at("width"));
     int height = std::stoi(parameters.at("height"));
     int seed = std::stoi(parameters.at("seed"));
+    int max_weight = parameters.count("max_weight") ? std::stoi(parameters.at("max_weight")) : 1;
+    bool contract = parameters.count("contract") && parameters.at("contract") == "1";
 
-    std::shared_ptr<generator> generator = std::make_shared<maze_generator>(width, height, seed);
+    std::shared_ptr<generator> generator = std::make_shared<maze_generator>(width, height, seed, max_weight, contract);
     return generator->generate();
 }
 
@@ -84,8 +90,9 @@ state_pointer problem_loader::generate_sat ( const std::map<std::string, std::st
     int num_clauses = std::stoi(parameters.at("num_clauses"));
     int max_literals = std::stoi(parameters.at("max_literals_per_clause"));
     int seed = std::stoi(parameters.at("seed"));
+    bool preprocess = parameters.count("preprocess") && parameters.at("preprocess") == "1";
 
-    std::shared_ptr<generator> generator = std::make_shared<sat_generator>(num_vars, num_clauses, max_literals, seed);
+    std::shared_ptr<generator> generator = std::make_shared<sat_generator>(num_vars, num_clauses, max_literals, seed, preprocess);
     return generator->generate();
 }
 
@@ -93,6 +100,12 @@ state_pointer problem_loader::generate_hanoi ( const std::map<std::string, std::
     int num_pegs = std::stoi(parameters.at("num_pegs"));
     int num_discs = std::stoi(parameters.at("num_discs"));
 
-    std::shared_ptr<generator> generator = std::make_shared<hanoi_generator>(num_pegs, num_discs);
+    std::shared_ptr<const hanoi_heuristic> heuristic = nullptr;
+    if ( parameters.count("pdb_size") ) {
+        std::string cache_directory = parameters.count("pdb_dir") ? parameters.at("pdb_dir") : "";
+        heuristic = hanoi_heuristic::create(num_pegs, num_discs, std::stoi(parameters.at("pdb_size")), cache_directory);
+    }
+
+    std::shared_ptr<generator> generator = std::make_shared<hanoi_generator>(num_pegs, num_discs, true, heuristic);
     return generator->generate();
 }
\ No newline at end of file
@@ -57,11 +57,24 @@ public:
      */
     static state_pointer load_problem ( const std::string &filename );
 
+    /**
+     * @brief Generates the initial state of a problem from its type and parameters.
+     *
+     * @param problem_type The type of the problem (e.g., "maze", "sat", "hanoi").
+     * @param parameters A map containing the parameters for the problem, as stored in problem files.
+     * @return A state_pointer representing the initial state of the problem.
+     *
+     * @throws std::runtime_error if the problem type is unknown.
+     * @throws std::out_of_range if a required parameter is missing.
+     */
+    static state_pointer create_problem ( const std::string &problem_type, const std::map<std::string, std::string> &parameters );
+
 private:
     /**
      * @brief Generates a maze problem based on the given parameters.
      *
-     * @param parameters A map containing the parameters for the maze problem. Must include "width", "height", and "seed".
+     * @param parameters A map containing the parameters for the maze problem. Must include "width", "height", and "seed",
+     *                   "max_weight" is optional (1 for an unweighted maze).
      * @return A state_pointer representing the initial state of the maze problem.
      *
      * @throws std::out_of_range if a required parameter is missing.
@@ -71,7 +84,8 @@ private:
     /**
      * @brief Generates a SAT problem based on the given parameters.
      *
-     * @param parameters A map containing the parameters for the SAT problem. Must include "num_variables", "num_clauses", "max_literals_per_clause", and "seed".
+     * @param parameters A map containing the parameters for the SAT problem. Must include "num_variables", "num_clauses", "max_literals_per_clause", and "seed",
+     *                   "preprocess" ("1" simplifies the problem with `sat_preprocessor`) is optional.
      * @return A state_pointer representing the initial state of the SAT problem.
      *
      * @throws std::out_of_range if a required parameter is missing.
@@ -81,7 +95,8 @@ private:
     /**
      * @brief Generates a Hanoi Towers problem based on the given parameters.
      *
-     * @param parameters A map containing the parameters for the Hanoi problem. Must include "num_pegs" and "num_discs".
+     * @param parameters A map containing the parameters for the Hanoi problem. Must include "num_pegs" and "num_discs",
+     *                   "pdb_size" (discs per pattern database) and "pdb_dir" (pattern database cache) are optional.
      * @return A state_pointer representing the initial state of the Hanoi Towers problem.
      *
      * @throws std::out_of_range if a required parameter is missing.
@@ -0,0 +1,299 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "search_api.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <omp.h>
+
+#include "problem_loader.h"
+#include "search_executor.h"
+#include "algorithms/bfs_solver.h"
+#include "algorithms/iddfs_solver.h"
+#include "algorithms/portfolio_solver.h"
+#include "algorithms/shm_bfs_solver.h"
+#include "algorithms/dist_bfs_solver.h"
+#include "algorithms/ucs_solver.h"
+#include "algorithms/beam_solver.h"
+#include "algorithms/frontier_bfs_solver.h"
+#include "algorithms/walksat_solver.h"
+#include "algorithms/gray_code_solver.h"
+#include "algorithms/component_solver.h"
+#include "algorithms/cube_solver.h"
+#include "algorithms/jps_solver.h"
+#include "algorithms/wavefront_bfs_solver.h"
+#include "generators/sat_generator.h"
+#include "preprocessing/maze_contractor.h"
+
+// State shared between a solve handle and the worker running the solve
+struct solve_handle::shared_state {
+    std::mutex mutex; ///< Protects the fields below that change while solving.
+    std::condition_variable finished; ///< Notified when the solve ends.
+    solve_status status = solve_status::PENDING; ///< The current status of the solve.
+    solve_result result; ///< The result, valid once the solve ended.
+    std::exception_ptr error = nullptr; ///< The exception thrown by the solver, if any.
+    std::chrono::steady_clock::time_point start_time; ///< When a worker picked up the solve.
+    std::chrono::steady_clock::time_point end_time; ///< When the solve ended.
+    std::unique_ptr<::solver> solver; ///< The solver, created before the solve is queued.
+    solve_options options; ///< The options of the search.
+    solve_callback callback; ///< The completion callback, may be empty.
+    std::atomic<bool> cancelled = false; ///< Set by `solve_handle::cancel`.
+
+    /**
+     * @brief Checks whether the solve ended. Must be called with `mutex` held.
+     *
+     * @return `true` if the status is final, `false` otherwise.
+     */
+    [[nodiscard]] bool has_ended () const {
+        return status != solve_status::PENDING && status != solve_status::RUNNING;
+    }
+};
+
+state_pointer search_api::create_problem ( const std::string &problem_type, const std::map<std::string, std::string> &parameters ) {
+    return problem_loader::create_problem(problem_type, parameters);
+}
+
+state_pointer search_api::load_problem ( const std::string &filename ) {
+    return problem_loader::load_problem(filename);
+}
+
+std::unique_ptr<solver> search_api::create_solver ( algorithm_type algorithm, const state_pointer &initial_state ) {
+    solve_options options;
+    options.algorithm = algorithm;
+    return create_solver(options, initial_state);
+}
+
+std::unique_ptr<solver> search_api::create_solver ( const solve_options &options, const state_pointer &initial_state ) {
+    bool is_sat = dynamic_cast<const sat_state*>(initial_state.get()) != nullptr;
+    if ( options.decompose_components && is_sat ) {
+        // Every component gets its own solver with the remaining options
+        solve_options component = options;
+        component.decompose_components = false;
+        return std::make_unique<component_solver>(initial_state, [component]( const state_pointer &state ) { return create_solver(component, state); });
+    }
+
+    bool is_walksat = options.algorithm == algorithm_type::WALKSAT_SEQ || options.algorithm == algorithm_type::WALKSAT_PAR;
+    walksat_solver::pick_rule rule = options.use_probsat ? walksat_solver::pick_rule::PROBSAT : walksat_solver::pick_rule::WALKSAT;
+    if ( options.local_search_first && !is_walksat && is_sat ) {
+        // Satisfiable instances are usually answered by the local search, the complete solver only runs if it gives up
+        solve_options complete = options;
+        complete.local_search_first = false;
+        return std::make_unique<walksat_solver>(initial_state, create_solver(complete, initial_state), rule);
+    }
+
+    switch ( options.algorithm ) {
+        case algorithm_type::BFS_SEQ:
+        case algorithm_type::BFS_PAR:
+            return std::make_unique<bfs_solver>(initial_state);
+        case algorithm_type::IDDFS_SEQ:
+        case algorithm_type::IDDFS_PAR:
+            return std::make_unique<iddfs_solver>(initial_state);
+        case algorithm_type::PORTFOLIO: {
+            // BFS wins on mazes and Hanoi, IDDFS on SAT - race both instead of guessing the instance class
+            std::vector<portfolio_solver::engine> engines;
+            engines.push_back({ algorithm_type::BFS_PAR, create_solver(algorithm_type::BFS_PAR, initial_state) });
+            engines.push_back({ algorithm_type::IDDFS_PAR, create_solver(algorithm_type::IDDFS_PAR, initial_state) });
+            return std::make_unique<portfolio_solver>(initial_state, std::move(engines));
+        }
+        case algorithm_type::BFS_SHM:
+            return std::make_unique<shm_bfs_solver>(initial_state, options.num_processes, options.partition_capacity);
+        case algorithm_type::BFS_DIST:
+            return std::make_unique<dist_bfs_solver>(initial_state, options.dist_rank, options.dist_size, options.dist_endpoint);
+        case algorithm_type::UCS_SEQ:
+        case algorithm_type::UCS_PAR:
+            return std::make_unique<ucs_solver>(initial_state);
+        case algorithm_type::BEAM_SEQ:
+        case algorithm_type::BEAM_PAR:
+            return std::make_unique<beam_solver>(initial_state, options.beam_width);
+        case algorithm_type::FRONTIER_SEQ:
+        case algorithm_type::FRONTIER_PAR:
+            return std::make_unique<frontier_bfs_solver>(initial_state);
+        case algorithm_type::WALKSAT_SEQ:
+        case algorithm_type::WALKSAT_PAR:
+            return std::make_unique<walksat_solver>(initial_state, nullptr, rule);
+        case algorithm_type::CUBE_SEQ:
+        case algorithm_type::CUBE_PAR:
+            return std::make_unique<cube_solver>(initial_state, options.cube_depth);
+        case algorithm_type::GRAY_SEQ:
+        case algorithm_type::GRAY_PAR:
+            return std::make_unique<gray_code_solver>(initial_state);
+        case algorithm_type::JPS:
+            return std::make_unique<jps_solver>(initial_state);
+        case algorithm_type::WAVE_SEQ:
+        case algorithm_type::WAVE_PAR:
+            return std::make_unique<wavefront_bfs_solver>(initial_state);
+    }
+    throw std::invalid_argument("Unknown algorithm type.");
+}
+
+solve_result search_api::solve ( const state_pointer &initial_state, const solve_options &options ) {
+    std::unique_ptr<solver> solver = create_solver(options, initial_state);
+    return run(*solver, options);
+}
+
+solve_result search_api::run ( solver &solver, const solve_options &options ) {
+    bool parallel = is_parallel_algorithm(options.algorithm);
+
+    // The thread count is an ICV of the calling thread, restore it so other callers are not affected
+    int previous_threads = omp_get_max_threads();
+    if ( options.num_threads > 0 ) omp_set_num_threads(options.num_threads);
+
+    solve_result result;
+    auto start_time = std::chrono::steady_clock::now();
+
+    try {
+        result.solution = parallel ? solver.solve_par() : solver.solve_seq();
+    } catch ( ... ) {
+        omp_set_num_threads(previous_threads);
+        throw;
+    }
+
+    auto end_time = std::chrono::steady_clock::now();
+    omp_set_num_threads(previous_threads);
+
+    result.found_solution = result.solution != nullptr;
+
+    // A contracted maze is solved on its junctions, the caller gets the path through the cells
+    if ( const auto *junction = dynamic_cast<const maze_junction_state*>(result.solution.get()) ) result.solution = junction->expand();
+    result.path = get_path(result.solution);
+    result.stats.duration = end_time - start_time;
+    result.stats.expanded_states = solver.get_expanded_states();
+    result.stats.path_length = result.path.empty() ? 0 : result.path.size() - 1;
+    for ( size_t i = 1; i < result.path.size(); ++i ) result.stats.path_cost += result.path[i]->get_step_cost();
+
+    if ( const auto *portfolio = dynamic_cast<const portfolio_solver*>(&solver) ) {
+        result.stats.winner = portfolio->get_winner();
+    }
+    if ( const auto *beam = dynamic_cast<const beam_solver*>(&solver) ) {
+        result.stats.proven_optimal = beam->is_proven_optimal();
+    }
+    return result;
+}
+
+solve_handle search_api::solve_async ( const state_pointer &initial_state, const solve_options &options, solve_callback callback ) {
+    auto state = std::make_shared<solve_handle::shared_state>();
+    state->solver = create_solver(options, initial_state);
+    state->options = options;
+    state->callback = std::move(callback);
+
+    // A worker owns only its share of the hardware threads, larger requests would oversubscribe the other workers
+    int max_threads = static_cast<int>(search_executor::shared().get_threads_per_worker());
+    if ( state->options.num_threads > max_threads ) state->options.num_threads = max_threads;
+
+    search_executor::shared().submit([state]() {
+        bool skipped;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->start_time = std::chrono::steady_clock::now();
+            skipped = state->cancelled;
+            if ( skipped ) {
+                state->status = solve_status::CANCELLED;
+                state->end_time = state->start_time;
+            } else state->status = solve_status::RUNNING;
+        }
+
+        if ( !skipped ) {
+            solve_result result;
+            std::exception_ptr error = nullptr;
+            try {
+                result = run(*state->solver, state->options);
+            } catch ( ... ) {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->result = std::move(result);
+            state->error = error;
+            state->end_time = std::chrono::steady_clock::now();
+            if ( error ) state->status = solve_status::FAILED;
+            else if ( state->cancelled && !state->result.found_solution ) state->status = solve_status::CANCELLED;
+            else state->status = solve_status::FINISHED;
+        }
+        state->finished.notify_all();
+
+        if ( state->callback ) {
+            try {
+                state->callback(state->status, state->result);
+            } catch ( ... ) {
+                // Callbacks run on executor threads, their errors cannot be reported anywhere
+            }
+        }
+    }, [state]() {
+        // Shutdown: the running solve returns early, a queued one never runs and ends here
+        state->cancelled = true;
+        state->solver->request_stop();
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if ( state->status == solve_status::PENDING ) {
+            state->status = solve_status::CANCELLED;
+            state->start_time = state->end_time = std::chrono::steady_clock::now();
+            state->finished.notify_all();
+        }
+    });
+
+    return solve_handle(state);
+}
+
+std::vector<state_pointer> search_api::get_path ( const state_pointer &solution ) {
+    std::vector<state_pointer> path;
+    for ( state_pointer current = solution; current != nullptr; current = current->get_predecessor() ) {
+        path.push_back(current);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+
+bool solve_handle::valid () const {
+    return state != nullptr;
+}
+
+void solve_handle::cancel () const {
+    if ( !state ) return;
+    state->cancelled = true;
+    state->solver->request_stop();
+}
+
+solve_progress solve_handle::get_progress () const {
+    solve_progress progress;
+    if ( !state ) return progress;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    progress.status = state->status;
+    progress.expanded_states = state->solver->get_expanded_states();
+    if ( state->status == solve_status::RUNNING ) {
+        progress.elapsed = std::chrono::steady_clock::now() - state->start_time;
+    } else if ( state->has_ended() ) {
+        progress.elapsed = state->end_time - state->start_time;
+    }
+    return progress;
+}
+
+bool solve_handle::is_ready () const {
+    if ( !state ) return false;
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->has_ended();
+}
+
+void solve_handle::wait () const {
+    if ( !state ) throw std::logic_error("Cannot wait on an empty solve handle.");
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [this]() { return state->has_ended(); });
+}
+
+bool solve_handle::wait_for ( std::chrono::milliseconds timeout ) const {
+    if ( !state ) throw std::logic_error("Cannot wait on an empty solve handle.");
+    std::unique_lock<std::mutex> lock(state->mutex);
+    return state->finished.wait_for(lock, timeout, [this]() { return state->has_ended(); });
+}
+
+solve_result solve_handle::get () const {
+    wait();
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if ( state->error ) std::rethrow_exception(state->error);
+    return state->result;
+}
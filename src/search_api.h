@@ -0,0 +1,285 @@
+/**
+ * @file search_api.h
+ * @brief Declares the public API of the search_core library.
+ *
+ * This header file is the entry point for programs that embed the solvers instead of running the
+ * `bfs_iddfs_benchmark` executable. It provides functions to create a problem, solve it with a selected
+ * algorithm and read back the result, its statistics and the solution path.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef SEARCH_API_H
+#define SEARCH_API_H
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <map>
+#include <memory>
+#include <chrono>
+#include <functional>
+#include <optional>
+
+#include "algorithm_result.h"
+#include "algorithms/solver.h"
+#include "state.h"
+
+/**
+ * @brief Version of the search_core API. Incremented whenever a declaration in this header changes incompatibly.
+ */
+#define SEARCH_API_VERSION 4
+
+
+/**
+ * @brief Options controlling how a problem is solved.
+ */
+struct solve_options {
+    algorithm_type algorithm = algorithm_type::BFS_PAR; ///< The algorithm used to solve the problem.
+    int num_threads = 0; ///< The number of OpenMP threads used by parallel algorithms (0 keeps the OpenMP default).
+    int num_processes = 0; ///< The number of worker processes used by multi-process algorithms (0 = one per NUMA node).
+    std::size_t partition_capacity = 1 << 20; ///< The maximum number of visited states of one multi-process BFS worker.
+    int dist_rank = 0; ///< The index of this process in a distributed solve.
+    int dist_size = 1; ///< The number of processes taking part in a distributed solve.
+    std::string dist_endpoint; ///< The endpoint shared by the processes of a distributed solve (see dist_bfs_solver.h).
+    std::size_t beam_width = 1000; ///< The maximum number of states kept per level by beam search.
+    unsigned int cube_depth = 0; ///< The depth of the cube-and-conquer split tree (0 derives it from the thread count).
+    bool decompose_components = false; ///< Split SAT problems into independent components, each solved by the chosen algorithm.
+    bool local_search_first = false; ///< Run WalkSAT on SAT problems before the chosen (complete) algorithm.
+    bool use_probsat = false; ///< Let the WalkSAT local search pick the flipped variables with the probSAT rule.
+};
+
+/**
+ * @brief Statistics collected while solving a problem.
+ */
+struct solve_stats {
+    std::chrono::duration<double> duration { 0 }; ///< The execution time of the algorithm in seconds.
+    unsigned long long expanded_states = 0; ///< The number of states whose descendents were generated.
+    std::size_t path_length = 0; ///< The number of moves on the solution path (0 if no solution was found).
+    unsigned long long path_cost = 0; ///< The sum of `state::get_step_cost` over the moves of the solution path.
+    std::optional<algorithm_type> winner; ///< For portfolio solves, the engine that produced the answer.
+    std::optional<bool> proven_optimal; ///< For beam search solves, whether the solution has the fewest moves (or none exists).
+};
+
+/**
+ * @brief The result of solving a problem.
+ */
+struct solve_result {
+    bool found_solution = false; ///< Flag indicating whether a solution was found.
+    state_pointer solution = nullptr; ///< The goal state (for a contracted maze, the `maze_state` of the goal cell), or nullptr if no solution was found.
+    std::vector<state_pointer> path; ///< The states from the initial state to the goal state, cell by cell for a contracted maze (empty if no solution was found).
+    solve_stats stats; ///< Statistics of the search.
+};
+
+
+/**
+ * @brief Lifecycle of an asynchronous solve.
+ */
+enum class solve_status : int {
+    PENDING,   ///< Waiting in the executor queue.
+    RUNNING,   ///< Being solved by a worker thread.
+    FINISHED,  ///< Finished, the result is available (with or without a solution).
+    CANCELLED, ///< Cancelled before it finished, the result holds no solution.
+    FAILED     ///< The solver threw an exception, `solve_handle::get` rethrows it.
+};
+
+/**
+ * @brief Snapshot of the progress of an asynchronous solve.
+ */
+struct solve_progress {
+    solve_status status = solve_status::PENDING; ///< The current status of the solve.
+    unsigned long long expanded_states = 0; ///< The number of states expanded so far.
+    std::chrono::duration<double> elapsed { 0 }; ///< Time spent solving so far (0 while pending).
+};
+
+/**
+ * @brief Callback invoked on the worker thread once an asynchronous solve ends.
+ *
+ * Receives the final status and the result. It is called for finished, cancelled and failed solves
+ * (a failed solve passes an empty result). Exceptions thrown by the callback are ignored.
+ */
+using solve_callback = std::function<void ( solve_status status, const solve_result &result )>;
+
+
+/**
+ * @brief Future-like handle to a solve running on the shared executor.
+ *
+ * Handles are cheap to copy, all copies refer to the same solve. The solve keeps running
+ * if every handle is destroyed.
+ */
+class solve_handle {
+public:
+    /**
+     * @brief Constructs an empty handle not associated with any solve.
+     */
+    solve_handle () = default;
+
+    /**
+     * @brief Checks whether the handle refers to a solve.
+     *
+     * @return `true` if the handle was returned by `search_api::solve_async`, `false` otherwise.
+     */
+    [[nodiscard]] bool valid () const;
+
+    /**
+     * @brief Cancels the solve.
+     *
+     * A pending solve never starts, a running solve is asked to stop. Has no effect on a solve that already ended.
+     */
+    void cancel () const;
+
+    /**
+     * @brief Returns the current progress of the solve.
+     *
+     * @return A snapshot of the status, expanded states and elapsed time.
+     */
+    [[nodiscard]] solve_progress get_progress () const;
+
+    /**
+     * @brief Checks whether the solve ended (finished, cancelled or failed).
+     *
+     * @return `true` if the result is available, `false` otherwise.
+     */
+    [[nodiscard]] bool is_ready () const;
+
+    /**
+     * @brief Blocks until the solve ends.
+     */
+    void wait () const;
+
+    /**
+     * @brief Blocks until the solve ends or the timeout expires.
+     *
+     * @param timeout The maximum time to wait.
+     * @return `true` if the solve ended, `false` on timeout.
+     */
+    bool wait_for ( std::chrono::milliseconds timeout ) const;
+
+    /**
+     * @brief Blocks until the solve ends and returns its result.
+     *
+     * @return The result of the solve (without a solution if it was cancelled).
+     * @throws The exception thrown by the solver if the solve failed.
+     * @throws std::logic_error if the handle is empty.
+     */
+    [[nodiscard]] solve_result get () const;
+
+private:
+    friend class search_api;
+
+    struct shared_state;
+
+    /**
+     * @brief Constructs a handle for the given solve.
+     *
+     * @param state The state shared between the handle and the worker running the solve.
+     */
+    explicit solve_handle ( std::shared_ptr<shared_state> state ) : state( std::move(state) ) {}
+
+    std::shared_ptr<shared_state> state; ///< The state of the solve, shared with the worker thread.
+};
+
+
+/**
+ * @brief Public entry point of the search_core library.
+ *
+ * This class provides static methods to create problems, run the solvers on them and inspect the results.
+ * All methods are reentrant, so independent problems can be solved from several threads at once.
+ */
+class search_api {
+public:
+    /**
+     * @brief Creates the initial state of a problem.
+     *
+     * @param problem_type The type of the problem ("maze", "sat" or "hanoi").
+     * @param parameters The parameters of the problem, using the same keys as problem files.
+     * @return A state_pointer representing the initial state of the problem.
+     *
+     * @throws std::runtime_error if the problem type is unknown.
+     * @throws std::out_of_range if a required parameter is missing.
+     * @throws std::invalid_argument if a parameter is out of range.
+     */
+    static state_pointer create_problem ( const std::string &problem_type, const std::map<std::string, std::string> &parameters );
+
+    /**
+     * @brief Loads a problem from a file.
+     *
+     * @param filename The name of the file to load the problem from.
+     * @return A state_pointer representing the initial state of the problem.
+     *
+     * @throws std::runtime_error if the file cannot be read or the problem type is unknown.
+     */
+    static state_pointer load_problem ( const std::string &filename );
+
+    /**
+     * @brief Creates a solver for the given algorithm.
+     *
+     * @param algorithm The algorithm to create a solver for.
+     * @param initial_state The initial state of the problem.
+     * @return A solver running the algorithm on the problem.
+     *
+     * @throws std::invalid_argument if the initial state is null or the algorithm is unknown.
+     */
+    static std::unique_ptr<solver> create_solver ( algorithm_type algorithm, const state_pointer &initial_state );
+
+    /**
+     * @brief Creates a solver for the algorithm of the given options.
+     *
+     * @param options The options of the search, selecting the algorithm and its settings.
+     * @param initial_state The initial state of the problem.
+     * @return A solver running the algorithm on the problem.
+     *
+     * @throws std::invalid_argument if the initial state is null or the algorithm is unknown.
+     */
+    static std::unique_ptr<solver> create_solver ( const solve_options &options, const state_pointer &initial_state );
+
+    /**
+     * @brief Solves a problem.
+     *
+     * @param initial_state The initial state of the problem.
+     * @param options The options of the search.
+     * @return A solve_result with the solution, the solution path and the search statistics.
+     *
+     * @throws std::invalid_argument if the initial state is null or the algorithm is unknown.
+     */
+    static solve_result solve ( const state_pointer &initial_state, const solve_options &options = {} );
+
+    /**
+     * @brief Solves a problem asynchronously on the shared executor.
+     *
+     * Returns immediately. The solve runs on a worker of `search_executor::shared()`. When the executor shuts down at
+     * process exit, a running solve is stopped and a queued one ends as cancelled without running or calling back.
+     * Parallel algorithms use the OpenMP team of the worker, `options.num_threads` is capped at
+     * `search_executor::get_threads_per_worker()`.
+     *
+     * @param initial_state The initial state of the problem.
+     * @param options The options of the search.
+     * @param callback Optional callback invoked on the worker thread when the solve ends.
+     * @return A handle used to wait for, poll or cancel the solve.
+     *
+     * @throws std::invalid_argument if the initial state is null or the algorithm is unknown.
+     */
+    static solve_handle solve_async ( const state_pointer &initial_state, const solve_options &options = {}, solve_callback callback = {} );
+
+    /**
+     * @brief Reconstructs the path leading to a state.
+     *
+     * @param solution The last state of the path.
+     * @return The states from the initial state to `solution`, or an empty vector if `solution` is null.
+     */
+    static std::vector<state_pointer> get_path ( const state_pointer &solution );
+
+private:
+    /**
+     * @brief Runs a solver with the given options and collects the result.
+     *
+     * @param solver The solver to run.
+     * @param options The options of the search.
+     * @return A solve_result with the solution, the solution path and the search statistics.
+     */
+    static solve_result run ( solver &solver, const solve_options &options );
+};
+
+#endif //SEARCH_API_H
@@ -0,0 +1,103 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "search_executor.h"
+
+#include <stdexcept>
+#include <algorithm>
+#include <omp.h>
+
+namespace {
+    void call_stop ( const std::function<void()> &stop ) {
+        try {
+            stop();
+        } catch ( ... ) {
+            // The executor is shutting down, there is nobody to report the error to
+        }
+    }
+}
+
+search_executor::search_executor ( unsigned int num_workers, unsigned int threads_per_worker ) : threads_per_worker( threads_per_worker ) {
+    if ( num_workers == 0 ) throw std::invalid_argument("Number of workers must be positive.");
+    if ( threads_per_worker == 0 ) throw std::invalid_argument("Number of threads per worker must be positive.");
+
+    running.resize(num_workers);
+    for ( unsigned int i = 0; i < num_workers; ++i ) {
+        workers.emplace_back([this, i]() { worker_loop(i); });
+    }
+}
+
+search_executor::~search_executor () {
+    // Abandoned solves must not keep the process alive, the queued ones are dropped and the running ones stopped
+    std::queue<entry> dropped;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        dropped.swap(tasks);
+        for ( auto &stop : running ) {
+            if ( stop ) call_stop(stop);
+        }
+    }
+    condition.notify_all();
+
+    for ( ; !dropped.empty(); dropped.pop() ) {
+        if ( dropped.front().stop ) call_stop(dropped.front().stop);
+    }
+
+    for ( std::thread &worker : workers ) {
+        worker.join();
+    }
+}
+
+void search_executor::submit ( std::function<void()> task, std::function<void()> stop ) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push({ std::move(task), std::move(stop) });
+    }
+    condition.notify_one();
+}
+
+unsigned int search_executor::get_worker_count () const {
+    return static_cast<unsigned int>(workers.size());
+}
+
+unsigned int search_executor::get_threads_per_worker () const {
+    return threads_per_worker;
+}
+
+search_executor& search_executor::shared () {
+    static const unsigned int hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+    static const unsigned int num_workers = std::min(hardware_threads, MAX_SHARED_WORKERS);
+    static search_executor executor(num_workers, hardware_threads / num_workers);
+    return executor;
+}
+
+void search_executor::worker_loop ( std::size_t index ) {
+    // The team size is a per-thread ICV, every parallel region of this worker's tasks inherits it
+    omp_set_num_threads(static_cast<int>(threads_per_worker));
+
+    while ( true ) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return stopping || !tasks.empty(); });
+
+            // The destructor empties the queue when it stops the executor
+            if ( stopping ) return;
+
+            task = std::move(tasks.front().task);
+            running[index] = std::move(tasks.front().stop);
+            tasks.pop();
+        }
+
+        try {
+            task();
+        } catch ( ... ) {
+            // Tasks report their own errors, a failing task must not kill the worker
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        running[index] = nullptr;
+    }
+}
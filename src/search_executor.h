@@ -0,0 +1,116 @@
+/**
+ * @file search_executor.h
+ * @brief Declares the search_executor class, a thread pool running asynchronous searches.
+ *
+ * This header file defines the `search_executor` class. It owns a fixed set of worker threads that
+ * take tasks from a shared queue, so that asynchronous solves do not create a thread per request.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef SEARCH_EXECUTOR_H
+#define SEARCH_EXECUTOR_H
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+
+/**
+ * @brief Fixed-size thread pool executing submitted tasks in FIFO order.
+ *
+ * Every worker may run a parallel solve with its own OpenMP team, so the pool caps the team size per worker: the
+ * workers together use about as many threads as there are hardware threads instead of workers times teams.
+ */
+class search_executor {
+public:
+    /**
+     * @brief Maximum number of workers of the shared executor, each gets an equal share of the hardware threads.
+     */
+    static constexpr unsigned int MAX_SHARED_WORKERS = 4;
+
+    /**
+     * @brief Constructor for the search_executor class. Starts the worker threads.
+     *
+     * @param num_workers The number of worker threads (must be positive).
+     * @param threads_per_worker The OpenMP team size of every worker (must be positive).
+     * @throws std::invalid_argument if num_workers or threads_per_worker is zero.
+     */
+    search_executor ( unsigned int num_workers, unsigned int threads_per_worker );
+
+    /**
+     * @brief Destructor for the search_executor class.
+     *
+     * Calls the stop function of the running tasks and of the queued ones, drops the queued tasks without running
+     * them and joins the worker threads, so shutdown waits only for the running tasks to notice the stop.
+     */
+    ~search_executor ();
+
+    search_executor ( const search_executor& ) = delete;
+    search_executor& operator= ( const search_executor& ) = delete;
+
+    /**
+     * @brief Queues a task for execution on one of the worker threads.
+     *
+     * @param task The task to run. Exceptions thrown by the task are discarded.
+     * @param stop Called on shutdown, from the destructor, to make a running task return early or to tell a queued
+     *             task that it will never run. May be empty, exceptions thrown by it are discarded.
+     */
+    void submit ( std::function<void()> task, std::function<void()> stop = {} );
+
+    /**
+     * @brief Returns the number of worker threads.
+     *
+     * @return The number of worker threads.
+     */
+    [[nodiscard]] unsigned int get_worker_count () const;
+
+    /**
+     * @brief Returns the largest OpenMP team a task may use.
+     *
+     * @return The number of OpenMP threads of every worker.
+     */
+    [[nodiscard]] unsigned int get_threads_per_worker () const;
+
+    /**
+     * @brief Returns the executor shared by the whole process.
+     *
+     * It is created on first use with up to `MAX_SHARED_WORKERS` workers, which split the hardware threads
+     * between their OpenMP teams.
+     *
+     * @return A reference to the shared executor.
+     */
+    static search_executor& shared ();
+
+private:
+    /**
+     * @brief A submitted task and its stop function.
+     */
+    struct entry {
+        std::function<void()> task; ///< The task to run.
+        std::function<void()> stop; ///< Stops the task on shutdown, may be empty.
+    };
+
+    /**
+     * @brief Main loop of a worker thread. Runs tasks until the executor is destroyed.
+     *
+     * @param index The index of the worker, its slot in `running`.
+     */
+    void worker_loop ( std::size_t index );
+
+    std::vector<std::thread> workers; ///< The worker threads.
+    unsigned int threads_per_worker; ///< The OpenMP team size of every worker.
+    std::queue<entry> tasks; ///< Tasks waiting for a worker.
+    std::vector<std::function<void()>> running; ///< The stop function of the task each worker runs.
+    std::mutex mutex; ///< Protects `tasks`, `running` and `stopping`.
+    std::condition_variable condition; ///< Signals new tasks and shutdown.
+    bool stopping = false; ///< Set by the destructor to let the workers exit.
+};
+
+#endif //SEARCH_EXECUTOR_H
@@ -0,0 +1,346 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "solver_server.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <cerrno>
+#include <stdexcept>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#define SOLVER_SERVER_SUPPORTED 1
+#endif
+
+#include "search_api.h"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace {
+    /**
+     * @brief Parses a non-negative decimal parameter of a request and checks its range.
+     *
+     * @throws std::invalid_argument if the value is not a decimal number between minimum and maximum.
+     */
+    std::size_t parse_count ( const std::string &key, const std::string &value, std::size_t minimum, std::size_t maximum ) {
+        // stoul would accept a sign and wrap "-1" around to the largest value
+        bool digits = !value.empty() && value.size() <= 9 && std::all_of(value.begin(), value.end(), []( unsigned char c ) { return std::isdigit(c); });
+        std::size_t count = digits ? std::stoul(value) : 0;
+        if ( !digits || count < minimum || count > maximum ) {
+            throw std::invalid_argument(key + " must be a number between " + std::to_string(minimum) + " and " + std::to_string(maximum) + ".");
+        }
+        return count;
+    }
+}
+
+algorithm_type solver_server::parse_algorithm ( const std::string &name ) {
+    if ( name == "bfs_seq" ) return algorithm_type::BFS_SEQ;
+    if ( name == "bfs_par" ) return algorithm_type::BFS_PAR;
+    if ( name == "iddfs_seq" ) return algorithm_type::IDDFS_SEQ;
+    if ( name == "iddfs_par" ) return algorithm_type::IDDFS_PAR;
+    if ( name == "portfolio" ) return algorithm_type::PORTFOLIO;
+    if ( name == "bfs_shm" ) return algorithm_type::BFS_SHM;
+    if ( name == "bfs_dist" ) return algorithm_type::BFS_DIST;
+    if ( name == "ucs_seq" ) return algorithm_type::UCS_SEQ;
+    if ( name == "ucs_par" ) return algorithm_type::UCS_PAR;
+    if ( name == "beam_seq" ) return algorithm_type::BEAM_SEQ;
+    if ( name == "beam_par" ) return algorithm_type::BEAM_PAR;
+    if ( name == "frontier_seq" ) return algorithm_type::FRONTIER_SEQ;
+    if ( name == "frontier_par" ) return algorithm_type::FRONTIER_PAR;
+    if ( name == "walksat_seq" ) return algorithm_type::WALKSAT_SEQ;
+    if ( name == "walksat_par" ) return algorithm_type::WALKSAT_PAR;
+    if ( name == "cube_seq" ) return algorithm_type::CUBE_SEQ;
+    if ( name == "cube_par" ) return algorithm_type::CUBE_PAR;
+    if ( name == "gray_seq" ) return algorithm_type::GRAY_SEQ;
+    if ( name == "gray_par" ) return algorithm_type::GRAY_PAR;
+    if ( name == "jps" ) return algorithm_type::JPS;
+    if ( name == "wave_seq" ) return algorithm_type::WAVE_SEQ;
+    if ( name == "wave_par" ) return algorithm_type::WAVE_PAR;
+    throw std::invalid_argument("Unknown algorithm: " + name);
+}
+
+std::string solver_server::format_algorithm ( algorithm_type type ) {
+    switch ( type ) {
+        case algorithm_type::BFS_SEQ: return "bfs_seq";
+        case algorithm_type::BFS_PAR: return "bfs_par";
+        case algorithm_type::IDDFS_SEQ: return "iddfs_seq";
+        case algorithm_type::IDDFS_PAR: return "iddfs_par";
+        case algorithm_type::PORTFOLIO: return "portfolio";
+        case algorithm_type::BFS_SHM: return "bfs_shm";
+        case algorithm_type::BFS_DIST: return "bfs_dist";
+        case algorithm_type::UCS_SEQ: return "ucs_seq";
+        case algorithm_type::UCS_PAR: return "ucs_par";
+        case algorithm_type::BEAM_SEQ: return "beam_seq";
+        case algorithm_type::BEAM_PAR: return "beam_par";
+        case algorithm_type::FRONTIER_SEQ: return "frontier_seq";
+        case algorithm_type::FRONTIER_PAR: return "frontier_par";
+        case algorithm_type::WALKSAT_SEQ: return "walksat_seq";
+        case algorithm_type::WALKSAT_PAR: return "walksat_par";
+        case algorithm_type::CUBE_SEQ: return "cube_seq";
+        case algorithm_type::CUBE_PAR: return "cube_par";
+        case algorithm_type::GRAY_SEQ: return "gray_seq";
+        case algorithm_type::GRAY_PAR: return "gray_par";
+        case algorithm_type::JPS: return "jps";
+        case algorithm_type::WAVE_SEQ: return "wave_seq";
+        case algorithm_type::WAVE_PAR: return "wave_par";
+    }
+    return "unknown";
+}
+
+std::string solver_server::handle_request ( const std::string &request ) {
+    ++requests;
+
+    std::istringstream arguments(request);
+    std::string command;
+    arguments >> command;
+
+    try {
+        if ( command == "metrics" ) return "ok " + format_metrics();
+
+        if ( command != "solve" ) throw std::invalid_argument("Unknown command: " + command);
+
+        std::string problem_type, algorithm_name;
+        if ( !(arguments >> problem_type >> algorithm_name) ) throw std::invalid_argument("Usage: solve <problem_type> <algorithm> [key=value ...]");
+
+        solve_options options;
+        options.algorithm = parse_algorithm(algorithm_name);
+        // bfs_shm forks inside the multithreaded daemon and bfs_dist blocks while it connects to its peers
+        if ( options.algorithm == algorithm_type::BFS_SHM || options.algorithm == algorithm_type::BFS_DIST ) {
+            throw std::invalid_argument(algorithm_name + " is not available in server mode.");
+        }
+
+        std::map<std::string, std::string> parameters;
+        std::string argument;
+        while ( arguments >> argument ) {
+            size_t separator = argument.find('=');
+            if ( separator == std::string::npos ) throw std::invalid_argument("Expected key=value, got: " + argument);
+            std::string key = argument.substr(0, separator);
+            std::string value = argument.substr(separator + 1);
+            if ( key == "threads" ) options.num_threads = static_cast<int>(parse_count(key, value, 0, MAX_THREADS));
+            else if ( key == "beam_width" ) options.beam_width = parse_count(key, value, 1, MAX_BEAM_WIDTH);
+            else if ( key == "cube_depth" ) options.cube_depth = static_cast<unsigned int>(parse_count(key, value, 0, MAX_CUBE_DEPTH));
+            else if ( key == "components" ) options.decompose_components = value == "1";
+            else if ( key == "walksat_first" ) options.local_search_first = value == "1";
+            else if ( key == "probsat" ) options.use_probsat = value == "1";
+            else if ( key == "pdb_dir" ) throw std::invalid_argument("pdb_dir cannot be set by clients, the server keeps pattern databases in memory.");
+            else parameters[key] = value;
+        }
+
+        check_instance_size(problem_type, parameters);
+        bool cached = false;
+        state_pointer instance = get_instance(problem_type, parameters, cached);
+
+        // Solve on the shared executor, its workers keep their OpenMP thread teams between requests
+        solve_result result = search_api::solve_async(instance, options).get();
+
+        ++solves;
+        if ( result.found_solution ) ++solutions;
+        expanded_states += result.stats.expanded_states;
+        solve_microseconds += static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::microseconds>(result.stats.duration).count());
+
+        std::ostringstream response;
+        response << "ok found=" << result.found_solution
+                 << " path_length=" << result.stats.path_length
+                 << " path_cost=" << result.stats.path_cost
+                 << " expanded_states=" << result.stats.expanded_states
+                 << " duration=" << result.stats.duration.count()
+                 << " cached=" << cached;
+        if ( result.stats.winner ) response << " winner=" << format_algorithm(*result.stats.winner);
+        if ( result.stats.proven_optimal ) response << " optimal=" << *result.stats.proven_optimal;
+        return response.str();
+    } catch ( const std::out_of_range &e ) {
+        ++errors;
+        return std::string("error Missing or invalid parameter: ") + e.what();
+    } catch ( const std::exception &e ) {
+        ++errors;
+        return std::string("error ") + e.what();
+    }
+}
+
+void solver_server::check_instance_size ( const std::string &problem_type, const std::map<std::string, std::string> &parameters ) {
+    // Missing keys are reported by the problem loader
+    auto check = [&parameters]( const std::string &key, std::size_t minimum, std::size_t maximum ) -> std::size_t {
+        auto it = parameters.find(key);
+        return it == parameters.end() ? 0 : parse_count(key, it->second, minimum, maximum);
+    };
+
+    if ( problem_type == "maze" ) {
+        check("width", 1, MAX_MAZE_SIDE);
+        check("height", 1, MAX_MAZE_SIDE);
+    } else if ( problem_type == "sat" ) {
+        check("num_variables", 1, MAX_SAT_VARIABLES);
+        check("num_clauses", 1, MAX_SAT_CLAUSES);
+        check("max_literals_per_clause", 1, MAX_SAT_LITERALS);
+    } else if ( problem_type == "hanoi" ) {
+        std::size_t num_pegs = check("num_pegs", 3, MAX_HANOI_PEGS);
+        std::size_t num_discs = check("num_discs", 1, MAX_HANOI_DISCS);
+        std::size_t pdb_size = check("pdb_size", 1, MAX_HANOI_DISCS);
+
+        // A pattern database stores one entry per placement of its discs
+        unsigned long long entries = 1;
+        for ( std::size_t i = 0; i < std::min(pdb_size, num_discs); ++i ) entries *= num_pegs;
+        if ( entries > MAX_PDB_ENTRIES ) {
+            throw std::invalid_argument("pdb_size is too large, a pattern database may have at most " + std::to_string(MAX_PDB_ENTRIES) + " entries.");
+        }
+    }
+}
+
+state_pointer solver_server::get_instance ( const std::string &problem_type, const std::map<std::string, std::string> &parameters, bool &cached ) {
+    std::string key = problem_type;
+    for ( const auto &pair : parameters ) key += " " + pair.first + "=" + pair.second;
+
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = cache.find(key);
+        if ( it != cache.end() ) {
+            cache_order.splice(cache_order.begin(), cache_order, it->second.second);
+            ++cache_hits;
+            cached = true;
+            return it->second.first;
+        }
+    }
+
+    // Generate outside the lock, a concurrent miss on the same key only generates the instance twice
+    state_pointer instance = search_api::create_problem(problem_type, parameters);
+    ++cache_misses;
+    cached = false;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if ( cache.find(key) == cache.end() && cache_capacity > 0 ) {
+        if ( cache.size() >= cache_capacity ) {
+            cache.erase(cache_order.back());
+            cache_order.pop_back();
+        }
+        cache_order.push_front(key);
+        cache[key] = { instance, cache_order.begin() };
+    }
+    return instance;
+}
+
+std::string solver_server::format_metrics () {
+    std::size_t cached_instances;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        cached_instances = cache.size();
+    }
+
+    std::ostringstream metrics;
+    metrics << "connections=" << connections
+            << " requests=" << requests
+            << " solves=" << solves
+            << " solutions=" << solutions
+            << " errors=" << errors
+            << " cache_hits=" << cache_hits
+            << " cache_misses=" << cache_misses
+            << " cached_instances=" << cached_instances
+            << " expanded_states=" << expanded_states
+            << " solve_seconds=" << static_cast<double>(solve_microseconds) / 1e6;
+    return metrics.str();
+}
+
+#ifdef SOLVER_SERVER_SUPPORTED
+
+void solver_server::serve () {
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if ( server < 0 ) throw std::runtime_error(std::string("Could not create socket: ") + std::strerror(errno));
+
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    if ( socket_path.size() >= sizeof(address.sun_path) ) {
+        close(server);
+        throw std::runtime_error("Socket path is too long: " + socket_path);
+    }
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    // Remove a stale socket left by a previous run
+    unlink(socket_path.c_str());
+
+    if ( bind(server, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(server, SOMAXCONN) < 0 ) {
+        std::string error = std::strerror(errno);
+        close(server);
+        throw std::runtime_error("Could not listen on " + socket_path + ": " + error);
+    }
+
+    std::cout << "Listening on " << socket_path << std::endl;
+
+    while ( true ) {
+        int client = accept(server, nullptr, nullptr);
+        if ( client < 0 ) {
+            if ( errno == EINTR ) continue;
+            std::string error = std::strerror(errno);
+            close(server);
+            throw std::runtime_error("Could not accept connection: " + error);
+        }
+
+        ++connections;
+        std::thread([this, client]() { handle_connection(client); }).detach();
+    }
+}
+
+void solver_server::handle_connection ( int client ) {
+    std::string buffer;
+    char chunk[4096];
+
+    while ( true ) {
+        ssize_t received = recv(client, chunk, sizeof(chunk), 0);
+        if ( received <= 0 ) break;
+        buffer.append(chunk, static_cast<size_t>(received));
+
+        size_t line_end;
+        bool quit = false;
+        // A request longer than the limit is refused without waiting for its newline
+        size_t first_line = buffer.find('\n');
+        if ( ( first_line == std::string::npos ? buffer.size() : first_line ) > MAX_REQUEST_LENGTH ) {
+            ++requests;
+            ++errors;
+            std::string response = "error Request is longer than " + std::to_string(MAX_REQUEST_LENGTH) + " bytes.\n";
+            send(client, response.data(), response.size(), MSG_NOSIGNAL);
+            break;
+        }
+
+        while ( !quit && (line_end = buffer.find('\n')) != std::string::npos ) {
+            std::string request = buffer.substr(0, line_end);
+            buffer.erase(0, line_end + 1);
+            if ( !request.empty() && request.back() == '\r' ) request.pop_back();
+            if ( request.empty() ) continue;
+
+            if ( request == "quit" ) {
+                quit = true;
+                break;
+            }
+
+            std::string response = handle_request(request) + "\n";
+            for ( size_t sent = 0; sent < response.size(); ) {
+                ssize_t written = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+                if ( written <= 0 ) {
+                    quit = true;
+                    break;
+                }
+                sent += static_cast<size_t>(written);
+            }
+        }
+        if ( quit ) break;
+    }
+
+    close(client);
+}
+
+#else
+
+void solver_server::serve () {
+    throw std::runtime_error("Unix domain sockets are not supported on this platform.");
+}
+
+void solver_server::handle_connection ( int ) {}
+
+#endif
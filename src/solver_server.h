@@ -0,0 +1,158 @@
+/**
+ * @file solver_server.h
+ * @brief Declares the solver_server class, a long-lived solver daemon listening on a Unix domain socket.
+ *
+ * This header file defines the `solver_server` class. The server accepts line-based text requests,
+ * solves them on the shared search executor and answers with the result and statistics. Generated
+ * problem instances are cached, so repeated requests skip instance generation.
+ *
+ * Protocol (one request per line, one response line per request):
+ *   - `solve <problem_type> <algorithm> [key=value ...]` - solves a problem, the parameters use the same keys
+ *     as problem files, plus the optional `threads=<n>`, `beam_width=<n>`, `cube_depth=<n>`, `walksat_first=<0|1>`, `probsat=<0|1>` and
+ *     `components=<0|1>`. The algorithm is one of `bfs_seq`, `bfs_par`, `iddfs_seq`,
+ *     `iddfs_par`, `portfolio`, `ucs_seq`, `ucs_par`, `beam_seq`, `beam_par`, `frontier_seq`,
+ *     `frontier_par`, `walksat_seq`, `walksat_par`, `cube_seq`, `cube_par`, `gray_seq`, `gray_par`, `jps`, `wave_seq`
+ *     and `wave_par`. Answers `ok found=<0|1> path_length=<n> path_cost=<n> expanded_states=<n> duration=<s> cached=<0|1>`,
+ *     portfolio solves also report `winner=<algorithm>` and beam solves `optimal=<0|1>`. The `pdb_dir` key is refused,
+ *     clients must not choose where the server writes files. `bfs_shm` and `bfs_dist` are refused, the first forks
+ *     the daemon and the second blocks while it connects to its peers.
+ *   - `metrics` - answers `ok` followed by the server counters as `key=value` pairs.
+ *   - `quit` - closes the connection.
+ * Errors are answered with `error <message>`. A request longer than `MAX_REQUEST_LENGTH` bytes is answered
+ * with an error and the connection is closed. Numeric options and instance sizes must be non-negative decimal
+ * numbers within the `MAX_` limits of the class, so one request cannot exhaust the memory of the daemon.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef SOLVER_SERVER_H
+#define SOLVER_SERVER_H
+
+#pragma once
+
+#include <string>
+#include <map>
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <utility>
+
+#include "algorithm_result.h"
+#include "state.h"
+
+
+/**
+ * @brief Solver daemon answering solve requests over a Unix domain socket.
+ */
+class solver_server {
+public:
+    static constexpr std::size_t MAX_REQUEST_LENGTH = 64 * 1024; ///< The longest accepted request line in bytes.
+    static constexpr std::size_t MAX_THREADS = 1024; ///< The largest accepted `threads`.
+    static constexpr std::size_t MAX_BEAM_WIDTH = 1 << 20; ///< The largest accepted `beam_width`.
+    static constexpr std::size_t MAX_CUBE_DEPTH = 20; ///< The largest accepted `cube_depth`, the split tree has up to 2^depth cubes.
+    static constexpr std::size_t MAX_MAZE_SIDE = 1001; ///< The largest accepted maze `width` and `height`.
+    static constexpr std::size_t MAX_SAT_VARIABLES = 4096; ///< The largest accepted `num_variables`.
+    static constexpr std::size_t MAX_SAT_CLAUSES = 65536; ///< The largest accepted `num_clauses`.
+    static constexpr std::size_t MAX_SAT_LITERALS = 64; ///< The largest accepted `max_literals_per_clause`.
+    static constexpr std::size_t MAX_HANOI_PEGS = 8; ///< The largest accepted `num_pegs`.
+    static constexpr std::size_t MAX_HANOI_DISCS = 20; ///< The largest accepted `num_discs`.
+    static constexpr unsigned long long MAX_PDB_ENTRIES = 1ULL << 24; ///< The most entries of one pattern database (`num_pegs` to the power of `pdb_size`).
+
+    /**
+     * @brief Constructor for the solver_server class.
+     *
+     * @param socket_path The filesystem path of the Unix domain socket.
+     * @param cache_capacity The maximum number of problem instances kept in the cache.
+     */
+    explicit solver_server ( std::string socket_path, std::size_t cache_capacity = 64 )
+        : socket_path ( std::move(socket_path) ), cache_capacity ( cache_capacity ) {}
+
+    /**
+     * @brief Listens on the socket and serves clients until the process is terminated.
+     *
+     * Every client connection is served by its own thread, the solves run on the shared search executor.
+     *
+     * @throws std::runtime_error if the socket cannot be created, bound or listened on,
+     *                             or if Unix domain sockets are not supported on this platform.
+     */
+    void serve ();
+
+    /**
+     * @brief Handles a single request line.
+     *
+     * @param request The request without the trailing newline.
+     * @return The response without the trailing newline.
+     */
+    std::string handle_request ( const std::string &request );
+
+    /**
+     * @brief Parses an algorithm name used in requests (e.g. "bfs_par").
+     *
+     * @param name The name of the algorithm.
+     * @return The corresponding algorithm type.
+     * @throws std::invalid_argument if the name is unknown.
+     */
+    static algorithm_type parse_algorithm ( const std::string &name );
+
+    /**
+     * @brief Formats an algorithm type as the name used in requests and responses.
+     *
+     * @param type The algorithm type.
+     * @return The name of the algorithm (e.g. "bfs_par").
+     */
+    static std::string format_algorithm ( algorithm_type type );
+
+private:
+    /**
+     * @brief Serves one client connection until it is closed.
+     *
+     * @param client The file descriptor of the connected client.
+     */
+    void handle_connection ( int client );
+
+    /**
+     * @brief Checks that the size parameters of a requested instance are numbers within the server limits.
+     *
+     * @param problem_type The type of the problem.
+     * @param parameters The parameters of the problem.
+     * @throws std::invalid_argument if a size parameter is not a number or exceeds its limit.
+     */
+    static void check_instance_size ( const std::string &problem_type, const std::map<std::string, std::string> &parameters );
+
+    /**
+     * @brief Returns a cached problem instance, generating and caching it on a miss.
+     *
+     * @param problem_type The type of the problem.
+     * @param parameters The parameters of the problem.
+     * @param cached Set to `true` if the instance was found in the cache.
+     * @return The initial state of the problem.
+     */
+    state_pointer get_instance ( const std::string &problem_type, const std::map<std::string, std::string> &parameters, bool &cached );
+
+    /**
+     * @brief Formats the server counters as `key=value` pairs.
+     *
+     * @return The formatted counters.
+     */
+    std::string format_metrics ();
+
+    std::string socket_path; ///< The filesystem path of the socket.
+    std::size_t cache_capacity; ///< The maximum number of cached instances.
+
+    std::mutex cache_mutex; ///< Protects `cache` and `cache_order`.
+    std::map<std::string, std::pair<state_pointer, std::list<std::string>::iterator>> cache; ///< Cached instances with their position in `cache_order`.
+    std::list<std::string> cache_order; ///< Cache keys from the most to the least recently used.
+
+    std::atomic<unsigned long long> connections = 0; ///< Number of accepted connections.
+    std::atomic<unsigned long long> requests = 0; ///< Number of handled requests.
+    std::atomic<unsigned long long> solves = 0; ///< Number of finished solves.
+    std::atomic<unsigned long long> solutions = 0; ///< Number of solves that found a solution.
+    std::atomic<unsigned long long> errors = 0; ///< Number of requests answered with an error.
+    std::atomic<unsigned long long> cache_hits = 0; ///< Number of instances served from the cache.
+    std::atomic<unsigned long long> cache_misses = 0; ///< Number of instances generated on request.
+    std::atomic<unsigned long long> expanded_states = 0; ///< Total number of states expanded by all solves.
+    std::atomic<unsigned long long> solve_microseconds = 0; ///< Total time spent solving.
+};
+
+#endif //SOLVER_SERVER_H
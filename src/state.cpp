@@ -0,0 +1,15 @@
+//
+// Created by Ondrej on 10/18/2026.
+//
+
+#include "state.h"
+
+successor_stream state::get_successors () const {
+    for ( state_pointer &child : get_descendents() ) co_yield std::move(child);
+}
+
+std::vector<state_pointer> state::collect_successors () const {
+    std::vector<state_pointer> children;
+    for ( const state_pointer &child : get_successors() ) children.push_back(child);
+    return children;
+}
@@ -18,6 +18,10 @@
 
 #include <vector>
 #include <memory>
+#include <string>
+#include <stdexcept>
+
+#include "successor_stream.h"
 
 class state;
 
@@ -54,6 +58,16 @@ public:
      */
     [[nodiscard]] virtual std::vector<state_pointer> get_descendents () const = 0;
 
+    /**
+     * @brief Yields the successor states one at a time, in the order of `get_descendents`.
+     *
+     * Successors are generated only when the stream is advanced, so a search that stops early does not pay for
+     * the rest. The state must outlive the stream. The default implementation yields the result of `get_descendents`.
+     *
+     * @return A stream of the successor states.
+     */
+    [[nodiscard]] virtual successor_stream get_successors () const;
+
     /**
      * @brief Pure virtual function to check if the current state is a goal state.
      *
@@ -73,6 +87,65 @@ public:
      */
     [[nodiscard]] virtual unsigned long long get_identifier () const = 0;
 
+    /**
+     * @brief Returns the cost of the move from the predecessor to the current state.
+     *
+     * Used by cost-aware searches such as uniform-cost search. Costs must be at least 1.
+     * The default implementation gives every move a cost of 1.
+     *
+     * @return The cost of the move.
+     */
+    [[nodiscard]] virtual unsigned int get_step_cost () const {
+        return 1;
+    }
+
+    /**
+     * @brief Value of `get_heuristic` for states from which no goal can be reached.
+     */
+    static constexpr unsigned long long UNREACHABLE = ~0ULL;
+
+    /**
+     * @brief Estimates the number of moves from the current state to the nearest goal.
+     *
+     * The estimate must never exceed the true number of moves (it must be admissible), so that searches
+     * pruning by it can prove their solutions optimal. The default implementation returns 0.
+     *
+     * @return A lower bound on the number of moves to a goal, or `UNREACHABLE` if no goal can be reached.
+     */
+    [[nodiscard]] virtual unsigned long long get_heuristic () const {
+        return 0;
+    }
+
+    /**
+     * @brief Encodes the current state into a byte string.
+     *
+     * Used to pass states between processes. All states of one problem must encode to the same number of bytes,
+     * and `decode` called on any state of the problem must rebuild an equivalent state from the encoding.
+     * The default implementation reports that the problem does not support encoding.
+     *
+     * @return The encoded state.
+     * @throws std::logic_error if the problem does not support encoding.
+     */
+    [[nodiscard]] virtual std::string encode () const {
+        throw std::logic_error("This problem does not support state encoding.");
+    }
+
+    /**
+     * @brief Rebuilds a state of the same problem from its encoding.
+     *
+     * The current state only provides the problem description (e.g., the maze grid or the SAT clauses).
+     *
+     * @param data A state encoded by `encode`.
+     * @param predecessor The predecessor of the rebuilt state, can be `nullptr`.
+     * @return A shared pointer to the rebuilt state.
+     * @throws std::logic_error if the problem does not support encoding.
+     */
+    [[nodiscard]] virtual state_pointer decode ( const std::string &data, const state_pointer predecessor ) const {
+        (void) data;
+        (void) predecessor;
+        throw std::logic_error("This problem does not support state encoding.");
+    }
+
     /**
      * @brief Returns the predecessor state of the current state.
      *
@@ -95,6 +168,16 @@ public:
      * Ensures proper cleanup of derived class objects when deleting through a base class pointer.
      */
     virtual ~state() = default;
+
+protected:
+    /**
+     * @brief Collects the successors yielded by `get_successors` into a vector.
+     *
+     * Problems that write their moves once, as the `get_successors` coroutine, implement `get_descendents` with it.
+     *
+     * @return A vector of shared pointers to the successor states.
+     */
+    [[nodiscard]] std::vector<state_pointer> collect_successors () const;
 };
 
 #endif // STATE_H
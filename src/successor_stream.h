@@ -0,0 +1,238 @@
+/**
+ * @file successor_stream.h
+ * @brief Defines the successor_stream coroutine type, which yields the successors of a state one at a time.
+ *
+ * This header file defines the `successor_stream` class, the return type of `state::get_successors`, and the
+ * `successor_frame_pool` class, a per-thread pool the coroutine frames are allocated from. A search that stops
+ * after the first few successors (e.g., IDDFS after reaching a goal) never generates the remaining ones.
+ *
+ * @author Ondrej Svarc
+ * @date Created on 10/18/2026
+ */
+
+#ifndef SUCCESSOR_STREAM_H
+#define SUCCESSOR_STREAM_H
+
+#pragma once
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+class state;
+
+
+/**
+ * @brief Per-thread pool of coroutine frames.
+ *
+ * Frames are grouped into size classes of `GRANULARITY` bytes. Freed frames are kept on the free list of the
+ * thread that frees them (up to `MAX_CACHED` per class) and reused by the next stream of a similar size, so a DFS
+ * creating one stream per expanded state does not go through the global allocator. Frames larger than the largest
+ * class use the global allocator directly.
+ */
+class successor_frame_pool {
+public:
+    /**
+     * @brief Allocates a coroutine frame.
+     *
+     * @param size The size of the frame in bytes.
+     * @return The allocated memory.
+     */
+    static void *allocate ( std::size_t size ) {
+        std::size_t size_class = get_size_class(size);
+        if ( size_class >= SIZE_CLASSES ) return ::operator new(size);
+
+        free_lists &lists = get_free_lists();
+        if ( free_block *block = lists.heads[size_class] ) {
+            lists.heads[size_class] = block->next;
+            --lists.counts[size_class];
+            return block;
+        }
+        return ::operator new(( size_class + 1 ) * GRANULARITY);
+    }
+
+    /**
+     * @brief Returns a coroutine frame to the pool of the calling thread.
+     *
+     * @param frame The memory returned by `allocate`.
+     * @param size The size passed to `allocate`.
+     */
+    static void deallocate ( void *frame, std::size_t size ) noexcept {
+        std::size_t size_class = get_size_class(size);
+        if ( size_class >= SIZE_CLASSES ) {
+            ::operator delete(frame);
+            return;
+        }
+
+        free_lists &lists = get_free_lists();
+        if ( lists.counts[size_class] >= MAX_CACHED ) {
+            ::operator delete(frame);
+            return;
+        }
+        lists.heads[size_class] = new ( frame ) free_block { lists.heads[size_class] };
+        ++lists.counts[size_class];
+    }
+
+private:
+    static constexpr std::size_t GRANULARITY = 64; ///< Size step between the size classes.
+    static constexpr std::size_t SIZE_CLASSES = 16; ///< Number of size classes, the largest holds 1 KiB frames.
+    static constexpr std::size_t MAX_CACHED = 256; ///< Maximum number of free frames kept per class and thread.
+
+    struct free_block {
+        free_block *next;
+    };
+
+    struct free_lists {
+        std::array<free_block*, SIZE_CLASSES> heads {};
+        std::array<std::size_t, SIZE_CLASSES> counts {};
+
+        ~free_lists () {
+            for ( free_block *head : heads ) {
+                while ( head ) {
+                    free_block *next = head->next;
+                    ::operator delete(head);
+                    head = next;
+                }
+            }
+        }
+    };
+
+    static std::size_t get_size_class ( std::size_t size ) {
+        return ( size + GRANULARITY - 1 ) / GRANULARITY - 1;
+    }
+
+    static free_lists &get_free_lists () {
+        thread_local free_lists lists;
+        return lists;
+    }
+};
+
+
+/**
+ * @brief Lazily generated sequence of successor states, produced by a coroutine.
+ *
+ * The stream is an input range: it can be iterated once, and each increment resumes the coroutine until it yields
+ * the next successor. Exceptions thrown by the coroutine are rethrown by the iteration.
+ */
+class successor_stream {
+public:
+    struct promise_type {
+        std::shared_ptr<const state> current; ///< The successor yielded last.
+        std::exception_ptr exception; ///< The exception thrown by the coroutine, if any.
+
+        successor_stream get_return_object () {
+            return successor_stream(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend () noexcept { return {}; }
+
+        std::suspend_always final_suspend () noexcept { return {}; }
+
+        std::suspend_always yield_value ( std::shared_ptr<const state> value ) noexcept {
+            current = std::move(value);
+            return {};
+        }
+
+        void return_void () noexcept {}
+
+        void unhandled_exception () {
+            exception = std::current_exception();
+        }
+
+        static void *operator new ( std::size_t size ) {
+            return successor_frame_pool::allocate(size);
+        }
+
+        static void operator delete ( void *frame, std::size_t size ) noexcept {
+            successor_frame_pool::deallocate(frame, size);
+        }
+    };
+
+    /**
+     * @brief Marks the end of the stream.
+     */
+    struct sentinel {};
+
+    /**
+     * @brief Input iterator over the successors.
+     */
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::shared_ptr<const state>;
+        using difference_type = std::ptrdiff_t;
+
+        explicit iterator ( std::coroutine_handle<promise_type> handle ) : handle( handle ) {}
+
+        const value_type &operator* () const {
+            return handle.promise().current;
+        }
+
+        iterator &operator++ () {
+            advance(handle);
+            return *this;
+        }
+
+        void operator++ ( int ) {
+            ++*this;
+        }
+
+        bool operator== ( sentinel ) const {
+            return handle.done();
+        }
+
+    private:
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    explicit successor_stream ( std::coroutine_handle<promise_type> handle ) : handle( handle ) {}
+
+    successor_stream ( successor_stream &&other ) noexcept : handle( std::exchange(other.handle, nullptr) ) {}
+
+    successor_stream &operator= ( successor_stream &&other ) noexcept {
+        if ( this != &other ) {
+            if ( handle ) handle.destroy();
+            handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+
+    successor_stream ( const successor_stream& ) = delete;
+    successor_stream &operator= ( const successor_stream& ) = delete;
+
+    ~successor_stream () {
+        if ( handle ) handle.destroy();
+    }
+
+    /**
+     * @brief Starts the coroutine and returns an iterator to the first successor.
+     *
+     * @return The iterator, equal to `end()` if there are no successors.
+     */
+    iterator begin () {
+        advance(handle);
+        return iterator(handle);
+    }
+
+    sentinel end () {
+        return {};
+    }
+
+private:
+    /**
+     * @brief Resumes the coroutine until its next successor or its end.
+     */
+    static void advance ( std::coroutine_handle<promise_type> handle ) {
+        handle.resume();
+        if ( handle.promise().exception ) std::rethrow_exception(std::exchange(handle.promise().exception, nullptr));
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+#endif //SUCCESSOR_STREAM_H